@@ -13,15 +13,12 @@ void AActor::InitActorTexture(const std::string& TexturePath, const sf::IntRect&
                               const sf::Vector2f& Size, const sf::Vector2f& Origin,
                               ASpriteManager& SpriteManager)
 {
-    ActorTexturePtr = std::make_unique<sf::Texture>();
+    // Взять текстуру из кэша, с диска она читается только при первом запросе
+    ActorTexture = SpriteManager.LoadTexture(TexturePath);
 
-    // Подгрузить текстуру из файла
-    if (!ActorTexturePtr->loadFromFile(TexturePath))
-    {
-        throw std::runtime_error("Error: Failed to load texture: " + ASSETS_PATH + TexturePath);
-    }
-
-    InitActorSprite(ActorTexturePtr, TextureRect, Size, Origin, SpriteManager);
+    // Лист может лежать на странице атласа, тогда прямоугольник смещается к его области
+    InitActorSprite(*ActorTexture, SpriteManager.ResolveTextureRect(TexturePath, TextureRect), Size, Origin,
+                    SpriteManager);
 }
 
 /**
@@ -36,25 +33,43 @@ void AActor::InitActorTexture(const sf::IntRect& TextureRect,
                               const sf::Vector2f& Size, const sf::Vector2f& Origin,
                               ASpriteManager& SpriteManager)
 {
-    ActorTexturePtr = std::make_unique<sf::Texture>();
+    ActorTexture = std::make_shared<sf::Texture>();
 
-    InitActorSprite(ActorTexturePtr, TextureRect, Size, Origin, SpriteManager);
+    InitActorSprite(*ActorTexture, TextureRect, Size, Origin, SpriteManager);
+}
+
+/**
+ * @brief Инициализирует спрайт объекта уже загруженной общей текстурой.
+ * 
+ * @param SharedTexture Общая текстура из кэша менеджера спрайтов.
+ * @param TextureRect Прямоугольник, ограничивающий текстуру.
+ * @param Size Размер объекта.
+ * @param Origin Установить центр объекта.
+ * @param SpriteManager Менеджер спрайтов для обработки спрайтов объекта.
+ */
+void AActor::InitActorTexture(const TextureHandle& SharedTexture, const sf::IntRect& TextureRect,
+                              const sf::Vector2f& Size, const sf::Vector2f& Origin,
+                              ASpriteManager& SpriteManager)
+{
+    ActorTexture = SharedTexture;
+
+    InitActorSprite(*ActorTexture, TextureRect, Size, Origin, SpriteManager);
 }
 
 /**
  * @brief Инициализирует спрайт объекта.
  * 
- * @param TexturePtr Указатель на текстуру.
+ * @param Texture Текстура объекта.
  * @param TextureRect Прямоугольник, ограничивающий текстуру.
  * @param DesiredSize Размер объекта.
  * @param Origin Установить центр объекта.
  * @param SpriteManager Менеджер спрайтов для обработки спрайтов объекта.
  */
-void AActor::InitActorSprite(const std::unique_ptr<sf::Texture>& TexturePtr, const sf::IntRect& TextureRect,
+void AActor::InitActorSprite(const sf::Texture& Texture, const sf::IntRect& TextureRect,
                              const sf::Vector2f& DesiredSize, const sf::Vector2f& Origin, ASpriteManager& SpriteManager)
 {
     // Создать спрайт объекта и установить его текстуру и прямоугольник
-    ActorSprite.setTexture(*TexturePtr);
+    ActorSprite.setTexture(Texture);
     ActorSprite.setTextureRect(TextureRect);
 
     // Установить масштаб объекта
@@ -112,6 +127,19 @@ void AActor::SetActorSprite(const sf::Sprite& NewActorSprite)
     ActorSprite = NewActorSprite;
 }
 
+/**
+ * @brief Добавляет объект в пакетную отрисовку кадра вместо отдельного вызова отрисовки.
+ * 
+ * По умолчанию добавляется спрайт объекта, наследники с дополнительными частями переопределяют метод.
+ * 
+ * @param SpriteBatch Пакетная отрисовка кадра.
+ * @param Layer Слой отрисовки объекта.
+ */
+void AActor::BatchActor(ASpriteBatch& SpriteBatch, ERenderLayer Layer) const
+{
+    SpriteBatch.AddSprite(ActorSprite, Layer);
+}
+
 /**
  * @brief Получает по ссылке текущую скорость объекта.
  *
@@ -151,3 +179,32 @@ sf::Sprite AActor::GetActorSprite() const
 {
     return ActorSprite;
 }
+
+/**
+ * @brief Помечает объект на уничтожение в конце кадра.
+ * 
+ * Объект остаётся в памяти, пока его владелец (пул пуль или хранилище сущностей) не освободит
+ * помеченные объекты в конце кадра, поэтому указатели на него остаются действительными до конца кадра.
+ */
+void AActor::MarkActorPendingDestroy()
+{
+    bIsPendingDestroy = true;
+}
+
+/**
+ * @brief Проверяет, помечен ли объект на уничтожение.
+ *
+ * @return true, если объект будет уничтожен в конце кадра, иначе false.
+ */
+bool AActor::IsActorPendingDestroy() const
+{
+    return bIsPendingDestroy;
+}
+
+/**
+ * @brief Снимает пометку на уничтожение, когда объект из пула используется повторно.
+ */
+void AActor::ClearActorPendingDestroy()
+{
+    bIsPendingDestroy = false;
+}
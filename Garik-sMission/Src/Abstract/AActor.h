@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "../Constants.h"
 #include "../Manager/SpriteManager.h"
+#include "../Manager/SpriteBatch.h"
 
 /**
  * @brief Базовый класс для всех игровых объектов.
@@ -46,17 +47,32 @@ public:
                                   const sf::Vector2f& Origin,
                                   ASpriteManager& SpriteManager);
 
+    /**
+     * @brief Инициализирует спрайт объекта уже загруженной общей текстурой.
+     * 
+     * @param SharedTexture Общая текстура из кэша менеджера спрайтов.
+     * @param TextureRect Прямоугольник, ограничивающий текстуру.
+     * @param Size Размер объекта.
+     * @param Origin Установить центр объекта.
+     * @param SpriteManager Менеджер спрайтов для обработки спрайтов объекта.
+     */
+    void InitActorTexture(const TextureHandle& SharedTexture,
+                          const sf::IntRect& TextureRect,
+                          const sf::Vector2f& Size,
+                          const sf::Vector2f& Origin,
+                          ASpriteManager& SpriteManager);
+
 private:
     /**
      * @brief Инициализирует спрайт объекта.
      * 
-     * @param TexturePtr Указатель на текстуру.
+     * @param Texture Текстура объекта.
      * @param TextureRect Прямоугольник, ограничивающий текстуру.
      * @param DesiredSize Размер объекта.
      * @param Origin Установить центр объекта.
      * @param SpriteManager Менеджер спрайтов для обработки спрайтов объекта.
      */
-    virtual void InitActorSprite(const std::unique_ptr<sf::Texture>& TexturePtr,
+    virtual void InitActorSprite(const sf::Texture& Texture,
                                  const sf::IntRect& TextureRect,
                                  const sf::Vector2f& DesiredSize,
                                  const sf::Vector2f& Origin,
@@ -97,6 +113,16 @@ public:
      * @param Window Окно, в котором происходит отрисовка.
      */
     virtual void DrawActor(::sf::RenderWindow& Window) = 0;
+
+    /**
+     * @brief Добавляет объект в пакетную отрисовку кадра вместо отдельного вызова отрисовки.
+     * 
+     * По умолчанию добавляется спрайт объекта, наследники с дополнительными частями переопределяют метод.
+     * 
+     * @param SpriteBatch Пакетная отрисовка кадра.
+     * @param Layer Слой отрисовки объекта.
+     */
+    virtual void BatchActor(ASpriteBatch& SpriteBatch, ERenderLayer Layer) const;
  
     /**
      * @brief Получает по ссылке текущую скорость объекта.
@@ -126,6 +152,26 @@ public:
      */
     sf::Sprite GetActorSprite() const;
 
+    /**
+     * @brief Помечает объект на уничтожение в конце кадра.
+     * 
+     * Объект остаётся в памяти, пока его владелец (пул пуль или хранилище сущностей) не освободит
+     * помеченные объекты в конце кадра, поэтому указатели на него остаются действительными до конца кадра.
+     */
+    void MarkActorPendingDestroy();
+
+    /**
+     * @brief Проверяет, помечен ли объект на уничтожение.
+     *
+     * @return true, если объект будет уничтожен в конце кадра, иначе false.
+     */
+    bool IsActorPendingDestroy() const;
+
+    /**
+     * @brief Снимает пометку на уничтожение, когда объект из пула используется повторно.
+     */
+    void ClearActorPendingDestroy();
+
 protected:
     sf::Vector2f ActorSize;                             // Размер объекта.
     sf::Vector2f ActorVelocity;                         // Вектор скорости.
@@ -134,5 +180,6 @@ protected:
     sf::Sprite ActorSprite;                             // Спрайт для установки текстуры.
 
 private:
-    std::unique_ptr<sf::Texture> ActorTexturePtr;       // Указатель на текстуру.
+    TextureHandle ActorTexture;                         // Общая текстура из кэша.
+    bool bIsPendingDestroy = false;                     // Помечен ли объект на уничтожение в конце кадра.
 };
@@ -2,14 +2,13 @@
 
 /**
  * @brief Конструктор класса APawn.
- * Инициализирует флаги и параметры здоровья, скорости, а также создает объекты для шкалы здоровья и её текстуры.
+ * Инициализирует флаги и параметры здоровья, скорости, а также создает объект шкалы здоровья.
  */
 APawn::APawn()
     : bIsPawnJump(false),
       PawnSpeed(0.f),
       PawnMaxHealth(0.f),
       PawnCurrentHealth(0.f),
-      PawnHealthBarTexturePtr(std::make_unique<sf::Texture>()),
       PawnHealthBarPtr(std::make_unique<AHealthBar>())
 {
 }
@@ -28,15 +27,13 @@ void APawn::InitPawnHealthBar(const std::string& TexturePath, const sf::Vector2f
                               const sf::Color& FillColor, const sf::Color& BackgroundColor,
                               ASpriteManager& SpriteManager)
 {
-    // Загрузка текстуры шкалы здоровья
-    if (!PawnHealthBarTexturePtr->loadFromFile(TexturePath))
-    {
-        throw std::runtime_error("Error: Failed to load texture: " + ASSETS_PATH + TexturePath);
-    }
-    
+    // Текстура шкалы здоровья общая для всех пешек с этим путём
+    PawnHealthBarTexture = SpriteManager.LoadTexture(TexturePath);
+
     // Инициализация шкалы здоровья
     PawnHealthBarPtr->InitHealthBar(Size, FillColor, BackgroundColor, SpriteManager);
-    HealthBarSprite.setTexture(*PawnHealthBarTexturePtr);
+    HealthBarSprite.setTexture(*PawnHealthBarTexture);
+    HealthBarSprite.setTextureRect(SpriteManager.GetTextureRegion(TexturePath));
     HealthBarSprite.setScale(Scale);
 }
 
@@ -54,7 +51,13 @@ void APawn::InitPawnHealthBar(const sf::Vector2f& Size,
 {
     // Инициализация шкалы здоровья
     PawnHealthBarPtr->InitHealthBar(Size, FillColor, BackgroundColor, SpriteManager);
-    HealthBarSprite.setTexture(*PawnHealthBarTexturePtr);
+
+    // Без текстуры спрайт шкалы использует пустую текстуру
+    if (!PawnHealthBarTexture)
+    {
+        PawnHealthBarTexture = std::make_shared<sf::Texture>();
+    }
+    HealthBarSprite.setTexture(*PawnHealthBarTexture);
 }
 
 /**
@@ -157,3 +160,13 @@ sf::Clock& APawn::GetDelayShotTimerHandle()
 {
     return DelayShotTimerHandle;
 }
+
+/**
+* @brief Получение состояния пересечений пешки с зонами-триггерами карты.
+* 
+* @return Ссылка на состояние пересечений.
+*/
+TriggerOverlapState& APawn::GetPawnTriggerOverlapState()
+{
+    return PawnTriggerOverlapState;
+}
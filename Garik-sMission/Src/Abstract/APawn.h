@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "AActor.h"
 #include "../UserInterface/HealthBar.h"
+#include "../GameMap/TriggerVolumeLayer.h"
 
 /**
  * @brief Класс APawn, производный от AActor. Представляет собой управляемую пешку с функционалом здоровья.
@@ -107,6 +108,13 @@ public:
      * @return Возвращает таймер задежки выстрела
      */
     sf::Clock& GetDelayShotTimerHandle();
+
+    /**
+     * @brief Получение состояния пересечений пешки с зонами-триггерами карты.
+     * 
+     * @return Ссылка на состояние пересечений.
+     */
+    TriggerOverlapState& GetPawnTriggerOverlapState();
  
 protected:
     bool bIsPawnJump;                                         // Флаг, показывающий, может ли пешка прыгать
@@ -115,8 +123,10 @@ protected:
     float PawnCurrentHealth;                                  // Текущее здоровье пешки.
 
     sf::Sprite HealthBarSprite;                               // Спрайт шкалы здоровья
-    std::unique_ptr<sf::Texture> PawnHealthBarTexturePtr;     // Указатель на текстуру шкалы здоровья
+    TextureHandle PawnHealthBarTexture;                       // Общая текстура шкалы здоровья
     std::unique_ptr<AHealthBar> PawnHealthBarPtr;             // Указатель на шкалу здоровья персонажа
 
     sf::Clock DelayShotTimerHandle;                           // Таймер для задержки выстрелов
+
+    TriggerOverlapState PawnTriggerOverlapState;              // Зоны-триггеры, которые пешка пересекала в прошлом кадре
 };
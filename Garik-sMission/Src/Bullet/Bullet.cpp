@@ -1,49 +1,46 @@
 ﻿#include "Bullet.h"
 
 /**
-* @brief Конструктор для инициализации пули.
-* 
-* @param NewVelocity Флаг, определяющий, имеет ли пуля новую скорость.
-* @param BulletSpeed Скорость полёта пули.
-* @param BulletDamage Урон наносимый от пули.
-* @param BulletTextureRect Прямоугольник текстуры пули.
-* @param ShootAt Тип цели, на которую направлена пуля.
-* @param DestroyEffect Тип эффекта, который будет проигрываться, когда пуля будет уничтожена.
-* @param StartPosition Начальная позиция пули.
-* @param SpriteManager Ссылка на менеджер спрайтов для отрисовки.
+* @brief Конструктор пустой пули для пула.
 */
-ABullet::ABullet(bool NewVelocity,
-                 const float BulletSpeed,
-                 const float BulletDamage,
-                 const sf::IntRect& BulletTextureRect,
-                 const EBulletType& ShootAt,
-                 const EBulletDestroyEffect& DestroyEffect,
-                 const sf::Vector2f& StartPosition,
-                 ASpriteManager& SpriteManager)
-    : BulletDamage(BulletDamage),
-      BulletType(ShootAt),
-      DestroyEffectType(DestroyEffect)
+ABullet::ABullet()
+    : BulletDamage(0.f),
+      BulletType(EBulletType::EBT_ShootAtPlayer),
+      DestroyEffectType(EBulletDestroyEffect::EBDE_BulletDefaultDestroy)
 {
-    ABullet::InitBullet(NewVelocity, BulletSpeed, BulletTextureRect, StartPosition, SpriteManager);
 }
 
 /**
- * @brief Инициализирует текстуру и создаёт спрайт для пули.
+ * @brief Инициализирует пулю для нового выстрела и создаёт спрайт из общей текстуры пуль.
  * 
+ * @param BulletTexture Общая текстура пуль.
  * @param NewVelocity Флаг, определяющий, имеет ли пуля новую скорость.
  * @param BulletSpeed Скорость полёта пули.
+ * @param NewBulletDamage Урон наносимый от пули.
  * @param BulletTextureRect Прямоугольник текстуры пули.
+ * @param ShootAt Тип цели, на которую направлена пуля.
+ * @param DestroyEffect Тип эффекта, который будет проигрываться, когда пуля будет уничтожена.
  * @param StartPosition Начальная позиция пули.
  * @param SpriteManager Ссылка на менеджер спрайтов для отрисовки.
  */
-void ABullet::InitBullet(const bool NewVelocity,
+void ABullet::InitBullet(const TextureHandle& BulletTexture,
+                         const bool NewVelocity,
                          const float BulletSpeed,
+                         const float NewBulletDamage,
                          const sf::IntRect& BulletTextureRect,
+                         const EBulletType& ShootAt,
+                         const EBulletDestroyEffect& DestroyEffect,
                          const sf::Vector2f& StartPosition,
                          ASpriteManager& SpriteManager)
 {
+    BulletDamage = NewBulletDamage;
+    BulletType = ShootAt;
+    DestroyEffectType = DestroyEffect;
+
+    // Пуля из пула могла быть уничтожена в прошлом выстреле
+    ClearActorPendingDestroy();
+
     // Инициализация переменных для текстуры пули
-    const std::string BulletTexturePath = ASSETS_PATH + "MainTiles/Bullets.png";
     const sf::Vector2f BulletSize = {
         static_cast<float>(BulletTextureRect.getSize().x),
         static_cast<float>(BulletTextureRect.getSize().y)
@@ -51,13 +48,14 @@ void ABullet::InitBullet(const bool NewVelocity,
     const sf::Vector2f BulletOrigin = {0.5f, 0.5f};
 
     // Установить направление, откуда начать движение
-    ActorVelocity.x = NewVelocity ? BulletSpeed : -BulletSpeed;
+    ActorVelocity = {NewVelocity ? BulletSpeed : -BulletSpeed, 0.f};
 
     // Устанавливаем размер коллизии для пули
     ActorCollisionRect = {StartPosition.x, StartPosition.y, BULLET_SIZE.x, BULLET_SIZE.y};
+    PreviousCollisionRect = ActorCollisionRect;
 
-    // Инициализировать текстуру для пули и создать спрайт для неё
-    AActor::InitActorTexture(BulletTexturePath, BulletTextureRect, BulletSize, BulletOrigin, SpriteManager);
+    // Создать спрайт из общей текстуры пуль, без загрузки текстуры с диска
+    AActor::InitActorTexture(BulletTexture, BulletTextureRect, BulletSize, BulletOrigin, SpriteManager);
 
     // Задать стартовую позицию пули
     ActorSprite.setPosition(StartPosition);
@@ -73,6 +71,9 @@ void ABullet::InitBullet(const bool NewVelocity,
 */
 void ABullet::UpdateBulletPosition(float DeltaTime)
 {
+    // Запоминаем положение до перемещения, чтобы коллизии проверялись по всему пути пули
+    PreviousCollisionRect = ActorCollisionRect;
+
     // Обновляем положение пули с учетом скорости и времени
     ActorCollisionRect.left += ActorVelocity.x * DeltaTime;
     ActorCollisionRect.top -= ActorVelocity.y * DeltaTime;
@@ -113,6 +114,26 @@ EBulletType ABullet::GetBulletType() const
     return BulletType;
 }
 
+/**
+* @brief Получение прямоугольника коллизии пули до последнего перемещения.
+* 
+* @return Прямоугольник коллизии пули в начале кадра.
+*/
+const sf::FloatRect& ABullet::GetBulletPreviousCollisionRect() const
+{
+    return PreviousCollisionRect;
+}
+
+/**
+* @brief Получение смещения пули за последнее перемещение.
+* 
+* @return Вектор от предыдущей позиции пули к текущей.
+*/
+sf::Vector2f ABullet::GetBulletDisplacement() const
+{
+    return {ActorCollisionRect.left - PreviousCollisionRect.left, ActorCollisionRect.top - PreviousCollisionRect.top};
+}
+
 /**
 * @brief Получение типа эффекта для пули, чтобы узнать .
 * 
@@ -25,30 +25,16 @@ enum class EBulletType
  * @brief Класс ABullet представляет собой сущность пули в игре.
  * Пуля может двигаться с заданной скоростью, проверять коллизии
  * с другими объектами и отрисовываться на экране.
+ * 
+ * Пули создаются заранее в ABulletPool и инициализируются заново при каждом выстреле.
  */
 class ABullet : public AActor
 {
 public:
     /**
-     * @brief Конструктор для инициализации пули.
-     * 
-     * @param NewVelocity Флаг, определяющий, имеет ли пуля новую скорость.
-     * @param BulletSpeed Скорость полёта пули.
-     * @param BulletDamage Урон наносимый от пули.
-     * @param BulletTextureRect Прямоугольник текстуры пули.
-     * @param ShootAt Тип цели, на которую направлена пуля.
-     * @param DestroyEffect Тип эффекта, который будет проигрываться, когда пуля будет уничтожена.
-     * @param StartPosition Начальная позиция пули.
-     * @param SpriteManager Ссылка на менеджер спрайтов для отрисовки.
+     * @brief Конструктор пустой пули для пула.
      */
-    ABullet(bool NewVelocity,
-            const float BulletSpeed,
-            const float BulletDamage,
-            const sf::IntRect& BulletTextureRect,
-            const EBulletType& ShootAt,
-            const EBulletDestroyEffect& DestroyEffect,
-            const sf::Vector2f& StartPosition,
-            ASpriteManager& SpriteManager);
+    ABullet();
 
     /**
      * @brief Деструктор для освобождения ресурсов.
@@ -56,19 +42,27 @@ public:
     ~ABullet() override = default;
 
     /**
-     * @brief Инициализирует текстуру и создаёт спрайт для пули.
+     * @brief Инициализирует пулю для нового выстрела и создаёт спрайт из общей текстуры пуль.
      * 
+     * @param BulletTexture Общая текстура пуль.
      * @param NewVelocity Флаг, определяющий, имеет ли пуля новую скорость.
      * @param BulletSpeed Скорость полёта пули.
+     * @param NewBulletDamage Урон наносимый от пули.
      * @param BulletTextureRect Прямоугольник текстуры пули.
+     * @param ShootAt Тип цели, на которую направлена пуля.
+     * @param DestroyEffect Тип эффекта, который будет проигрываться, когда пуля будет уничтожена.
      * @param StartPosition Начальная позиция пули.
      * @param SpriteManager Ссылка на менеджер спрайтов для отрисовки.
      */
-    virtual void InitBullet(const bool NewVelocity,
-                            const float BulletSpeed,
-                            const sf::IntRect& BulletTextureRect,
-                            const sf::Vector2f& StartPosition,
-                            ASpriteManager& SpriteManager);
+    void InitBullet(const TextureHandle& BulletTexture,
+                    const bool NewVelocity,
+                    const float BulletSpeed,
+                    const float NewBulletDamage,
+                    const sf::IntRect& BulletTextureRect,
+                    const EBulletType& ShootAt,
+                    const EBulletDestroyEffect& DestroyEffect,
+                    const sf::Vector2f& StartPosition,
+                    ASpriteManager& SpriteManager);
 
     /**
      * @brief Обновляет позицию пули на основе прошедшего времени.
@@ -98,6 +92,20 @@ public:
      */
     EBulletType GetBulletType() const;
 
+    /**
+     * @brief Получение прямоугольника коллизии пули до последнего перемещения.
+     * 
+     * @return Прямоугольник коллизии пули в начале кадра.
+     */
+    const sf::FloatRect& GetBulletPreviousCollisionRect() const;
+
+    /**
+     * @brief Получение смещения пули за последнее перемещение.
+     * 
+     * @return Вектор от предыдущей позиции пули к текущей.
+     */
+    sf::Vector2f GetBulletDisplacement() const;
+
     /**
      * @brief Получение типа эффекта для пули, чтобы узнать .
      * 
@@ -106,7 +114,8 @@ public:
     EBulletDestroyEffect GetBulletDestroyEffectType() const;
 
 private:
-    const float BulletDamage;                  // Урон, наносимый пулей.
+    float BulletDamage;                        // Урон, наносимый пулей.
+    sf::FloatRect PreviousCollisionRect;       // Прямоугольник коллизии до последнего перемещения, для проверки по пути пули.
  
     EBulletType BulletType;                    // Тип пули (игрок или враг).
     EBulletDestroyEffect DestroyEffectType;    // Какой эффекту уничтожения проигрывать
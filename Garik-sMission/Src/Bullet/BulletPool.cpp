@@ -0,0 +1,102 @@
+﻿#include "BulletPool.h"
+
+/**
+ * @brief Получает общую текстуру пуль и создаёт пули пула.
+ *
+ * Повторный вызов ничего не делает, пул создаётся один раз.
+ *
+ * @param SpriteManager Менеджер спрайтов с кэшем текстур.
+ * @param Capacity Количество пуль в пуле.
+ */
+void ABulletPool::InitBulletPool(ASpriteManager& SpriteManager, size_t Capacity)
+{
+    if (!BulletSlots.empty())
+    {
+        return;
+    }
+
+    const std::string BulletTexturePath = ASSETS_PATH + "MainTiles/Bullets.png";
+    BulletTexture = SpriteManager.LoadTexture(BulletTexturePath);
+    BulletSheetOffset = SpriteManager.GetTextureRegion(BulletTexturePath).getPosition();
+
+    BulletSlots = std::vector<ABullet>(Capacity);
+
+    FreeBullets.reserve(Capacity);
+    for (ABullet& Bullet : BulletSlots)
+    {
+        FreeBullets.emplace_back(&Bullet);
+    }
+}
+
+/**
+ * @brief Берёт свободную пулю из пула и инициализирует её для выстрела.
+ *
+ * @param NewVelocity Флаг, определяющий, имеет ли пуля новую скорость.
+ * @param BulletSpeed Скорость полёта пули.
+ * @param BulletDamage Урон наносимый от пули.
+ * @param BulletTextureRect Прямоугольник текстуры пули.
+ * @param ShootAt Тип цели, на которую направлена пуля.
+ * @param DestroyEffect Тип эффекта, который будет проигрываться, когда пуля будет уничтожена.
+ * @param StartPosition Начальная позиция пули.
+ * @param SpriteManager Ссылка на менеджер спрайтов для отрисовки.
+ *
+ * @return Указатель на пулю или nullptr, если свободных пуль не осталось.
+ */
+ABullet* ABulletPool::AcquireBullet(const bool NewVelocity,
+                                    const float BulletSpeed,
+                                    const float BulletDamage,
+                                    const sf::IntRect& BulletTextureRect,
+                                    const EBulletType& ShootAt,
+                                    const EBulletDestroyEffect& DestroyEffect,
+                                    const sf::Vector2f& StartPosition,
+                                    ASpriteManager& SpriteManager)
+{
+    // Если все пули в полёте, выстрел пропускается
+    if (FreeBullets.empty())
+    {
+        return nullptr;
+    }
+
+    ABullet* Bullet = FreeBullets.back();
+    FreeBullets.pop_back();
+
+    // Прямоугольник пули задан на листе пуль, переводим его в координаты общей текстуры
+    const sf::IntRect SheetTextureRect = {BulletTextureRect.getPosition() + BulletSheetOffset, BulletTextureRect.getSize()};
+
+    Bullet->InitBullet(BulletTexture, NewVelocity, BulletSpeed, BulletDamage, SheetTextureRect,
+                       ShootAt, DestroyEffect, StartPosition, SpriteManager);
+
+    return Bullet;
+}
+
+/**
+ * @brief Возвращает пули, помеченные на уничтожение, в пул и убирает их из вектора.
+ *
+ * Порядок оставшихся пуль сохраняется.
+ *
+ * @param BulletsVectorPtr Вектор летящих пуль.
+ */
+void ABulletPool::ReleasePendingBullets(std::vector<ABullet*>& BulletsVectorPtr)
+{
+    std::erase_if(BulletsVectorPtr, [this](ABullet* Bullet)
+    {
+        if (!Bullet->IsActorPendingDestroy())
+        {
+            return false;
+        }
+
+        FreeBullets.emplace_back(Bullet);
+        return true;
+    });
+}
+
+/**
+ * @brief Возвращает все пули вектора в пул и очищает вектор.
+ *
+ * @param BulletsVectorPtr Вектор летящих пуль.
+ */
+void ABulletPool::ReleaseAllBullets(std::vector<ABullet*>& BulletsVectorPtr)
+{
+    FreeBullets.insert(FreeBullets.end(), BulletsVectorPtr.begin(), BulletsVectorPtr.end());
+    BulletsVectorPtr.clear();
+}
@@ -0,0 +1,78 @@
+﻿#pragma once
+#include "Bullet.h"
+
+/**
+ * @brief Пул пуль фиксированного размера.
+ *
+ * Все пули создаются один раз при инициализации и используют одну общую текстуру,
+ * поэтому выстрел не выделяет память, не читает файл и не загружает текстуру в видеопамять.
+ * Уничтоженные пули возвращаются в пул и используются для следующих выстрелов.
+ */
+class ABulletPool
+{
+public:
+    /**
+     * @brief Конструктор класса ABulletPool.
+     */
+    ABulletPool() = default;
+
+    /**
+     * @brief Деструктор класса ABulletPool.
+     */
+    ~ABulletPool() = default;
+
+    /**
+     * @brief Получает общую текстуру пуль и создаёт пули пула.
+     *
+     * Повторный вызов ничего не делает, пул создаётся один раз.
+     *
+     * @param SpriteManager Менеджер спрайтов с кэшем текстур.
+     * @param Capacity Количество пуль в пуле.
+     */
+    void InitBulletPool(ASpriteManager& SpriteManager, size_t Capacity = BULLET_POOL_CAPACITY);
+
+    /**
+     * @brief Берёт свободную пулю из пула и инициализирует её для выстрела.
+     *
+     * @param NewVelocity Флаг, определяющий, имеет ли пуля новую скорость.
+     * @param BulletSpeed Скорость полёта пули.
+     * @param BulletDamage Урон наносимый от пули.
+     * @param BulletTextureRect Прямоугольник текстуры пули.
+     * @param ShootAt Тип цели, на которую направлена пуля.
+     * @param DestroyEffect Тип эффекта, который будет проигрываться, когда пуля будет уничтожена.
+     * @param StartPosition Начальная позиция пули.
+     * @param SpriteManager Ссылка на менеджер спрайтов для отрисовки.
+     *
+     * @return Указатель на пулю или nullptr, если свободных пуль не осталось.
+     */
+    ABullet* AcquireBullet(const bool NewVelocity,
+                           const float BulletSpeed,
+                           const float BulletDamage,
+                           const sf::IntRect& BulletTextureRect,
+                           const EBulletType& ShootAt,
+                           const EBulletDestroyEffect& DestroyEffect,
+                           const sf::Vector2f& StartPosition,
+                           ASpriteManager& SpriteManager);
+
+    /**
+     * @brief Возвращает пули, помеченные на уничтожение, в пул и убирает их из вектора.
+     *
+     * Порядок оставшихся пуль сохраняется.
+     *
+     * @param BulletsVectorPtr Вектор летящих пуль.
+     */
+    void ReleasePendingBullets(std::vector<ABullet*>& BulletsVectorPtr);
+
+    /**
+     * @brief Возвращает все пули вектора в пул и очищает вектор.
+     *
+     * @param BulletsVectorPtr Вектор летящих пуль.
+     */
+    void ReleaseAllBullets(std::vector<ABullet*>& BulletsVectorPtr);
+
+private:
+    TextureHandle BulletTexture;                // Общая текстура всех пуль
+    sf::Vector2i BulletSheetOffset;             // Смещение листа пуль на текстуре (ненулевое, если лист в атласе)
+    std::vector<ABullet> BulletSlots;           // Пули пула, вектор не меняет размер, поэтому указатели стабильны
+    std::vector<ABullet*> FreeBullets;          // Свободные пули, последняя освобождённая выдаётся первой
+};
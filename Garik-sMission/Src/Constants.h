@@ -90,6 +90,38 @@ const sf::Vector2f ENEMY_SIZE = {10.f, 15.f};
  */
 const sf::Vector2f BULLET_SIZE = {3.f, 3.f};
 
+/**
+ * @brief Количество пуль в пуле, больше одновременно летящих пуль не создаётся.
+ */
+constexpr size_t BULLET_POOL_CAPACITY = 128;
+
+/**
+ * @brief Количество экземпляров одного эффекта частиц, под которое память резервируется заранее.
+ *
+ * Сверх этого количества новые экземпляры эффекта не запускаются.
+ */
+constexpr size_t PARTICLE_POOL_CAPACITY = 256;
+
+/**
+ * @brief Количество голосов (источников OpenAL), общих для всех звуковых эффектов.
+ */
+constexpr size_t SOUND_VOICE_POOL_CAPACITY = 16;
+
+/**
+ * @brief Размер области, в которой враг замечает персонажа (по центру врага).
+ */
+const sf::Vector2f ENEMY_DETECTION_AREA_SIZE = {230.f, 10.f};
+
+/**
+ * @brief Время, в течение которого враг продолжает считать персонажа обнаруженным после потери из виду.
+ */
+constexpr float ENEMY_DETECTION_TIMEOUT = 2.f;
+
+/**
+ * @brief Размер блока памяти арены уровня (сундуки, лечащие объекты).
+ */
+constexpr size_t LEVEL_ARENA_BLOCK_SIZE = 64 * 1024;
+
 /**
  * @brief Масштаб для отрисовки игровых объектов.
  */
@@ -99,3 +131,30 @@ const sf::Vector2f DRAW_SCALE = {1.f, 1.f};
  * @brief Путь к папке с ресурсами игры.
  */
 const std::string ASSETS_PATH = "Assets/";
+
+/**
+ * @brief Размер ячейки сетки для поиска коллизий препятствий карты.
+ */
+constexpr float COLLISION_GRID_CELL_SIZE = 64.f;
+
+/**
+ * @brief Имя булева свойства тайла или тайлсета, которое делает тайл твёрдым для коллизий.
+ */
+const std::string TILE_SOLID_PROPERTY = "Solid";
+
+/**
+ * @brief Размер стороны чанка тайловой карты в тайлах, карта отрисовывается чанками, попавшими в камеру.
+ */
+constexpr uint32_t TILE_CHUNK_SIZE = 32;
+
+/**
+ * @brief Имя вещественного свойства тайлового слоя, которое делает слой параллакс-фоном.
+ *
+ * Значение - коэффициент горизонтальной прокрутки слоя относительно камеры (0 - слой неподвижен на экране, 1 - как карта).
+ */
+const std::string LAYER_PARALLAX_PROPERTY = "ParallaxFactor";
+
+/**
+ * @brief Путь к таблице атласа текстур, которую собирает AtlasPacker перед сборкой игры.
+ */
+const std::string TEXTURE_ATLAS_PATH = ASSETS_PATH + "Atlas/MainTiles.atlas";
@@ -0,0 +1,262 @@
+﻿#include "EntityComponentStore.h"
+
+/**
+ * @brief Заполняет параметры всех типов врагов.
+ *
+ * @param SpriteManager Менеджер спрайтов с кэшем текстур.
+ */
+void AEntityComponentStore::InitEnemyArchetypes(ASpriteManager& SpriteManager)
+{
+    const std::string EnemyTexturePath = ASSETS_PATH + "MainTiles/Enemy.png";
+    const float WalkFrameSpeed = 5.f;
+    const int EnemyWidth = static_cast<int>(ENEMY_SIZE.x);
+    const int EnemyHeight = static_cast<int>(ENEMY_SIZE.y);
+
+    // Прямоугольник текстуры пули обычных врагов
+    const sf::IntRect EnemyBulletRect = sf::IntRect(7, 72, static_cast<int>(BULLET_SIZE.x),
+                                                    static_cast<int>(BULLET_SIZE.y));
+
+    EnemyArchetypes.clear();
+    EnemyArchetypes.resize(4);
+
+    // Зеленый враг
+    EnemyArchetype& Green = EnemyArchetypes[static_cast<size_t>(EEnemyType::EET_Green)];
+    Green.WalkClip = SpriteManager.LoadAnimationClip("Enemy_GreenWalk", EnemyTexturePath,
+        {{36, 1, EnemyWidth, EnemyHeight}, {52, 1, EnemyWidth, EnemyHeight}}, WalkFrameSpeed);
+    Green.EnemySize = {ENEMY_SIZE.x * DRAW_SCALE.x, ENEMY_SIZE.y * DRAW_SCALE.y};
+    Green.BulletTextureRect = EnemyBulletRect;
+
+    // Красный враг
+    EnemyArchetype& Red = EnemyArchetypes[static_cast<size_t>(EEnemyType::EET_Red)];
+    Red.WalkClip = SpriteManager.LoadAnimationClip("Enemy_RedWalk", EnemyTexturePath,
+        {{4, 1, EnemyWidth, EnemyHeight}, {20, 1, EnemyWidth, EnemyHeight}}, WalkFrameSpeed);
+    Red.EnemySize = {ENEMY_SIZE.x * DRAW_SCALE.x, ENEMY_SIZE.y * DRAW_SCALE.y};
+    Red.BulletTextureRect = EnemyBulletRect;
+
+    // Синий враг, у него другой размер спрайта и пуля вылетает чуть выше
+    EnemyArchetype& Blue = EnemyArchetypes[static_cast<size_t>(EEnemyType::EET_Blue)];
+    Blue.EnemySize = {ENEMY_SIZE.x + 1, ENEMY_SIZE.y - 1};
+    Blue.WalkClip = SpriteManager.LoadAnimationClip("Enemy_BlueWalk", EnemyTexturePath,
+        {
+            {3, 18, static_cast<int>(Blue.EnemySize.x), static_cast<int>(Blue.EnemySize.y)},
+            {19, 18, static_cast<int>(Blue.EnemySize.x), static_cast<int>(Blue.EnemySize.y)}
+        }, WalkFrameSpeed);
+    Blue.BulletTextureRect = EnemyBulletRect;
+    Blue.BulletOffsetY = 8.f;
+
+    // Босс стреляет рокетами и после смерти оставляет ключ
+    EnemyArchetype& Boss = EnemyArchetypes[static_cast<size_t>(EEnemyType::EET_Boss)];
+    Boss.WalkClip = SpriteManager.LoadAnimationClip("Enemy_BossWalk", EnemyTexturePath,
+        {{48, 33, EnemyWidth, EnemyHeight}, {32, 33, EnemyWidth, EnemyHeight}}, WalkFrameSpeed);
+    Boss.EnemySize = {15.f * DRAW_SCALE.x, 22.f * DRAW_SCALE.y};
+    Boss.EnemyScale = 1.5f;
+    Boss.MaxHealth = BOSS_ENEMY_MAX_HEALTH;
+    Boss.ShootingDelay = 0.55f;
+    Boss.HealthBarSize = {17.f, 3.f};
+    Boss.BulletTextureRect = sf::IntRect(3, 7, static_cast<int>(BULLET_SIZE.x) + 8,
+                                         static_cast<int>(BULLET_SIZE.y) + 2);
+    Boss.BulletDamage = ROCKET_DAMAGE;
+    Boss.BulletDestroyEffect = EBulletDestroyEffect::EBDE_RocketDestroy;
+    Boss.BulletOffsetY = 15.f;
+    Boss.bDropsKeyOnDeath = true;
+}
+
+/**
+ * @brief Получение параметров типа врага.
+ *
+ * @param EnemyType Тип врага.
+ *
+ * @return Параметры типа врага.
+ */
+const EnemyArchetype& AEntityComponentStore::GetEnemyArchetype(EEnemyType EnemyType) const
+{
+    return EnemyArchetypes[static_cast<size_t>(EnemyType)];
+}
+
+/**
+ * @brief Резервирует место под сущности во всех массивах компонентов.
+ *
+ * @param Capacity Количество сущностей.
+ */
+void AEntityComponentStore::ReserveEntities(size_t Capacity)
+{
+    EnemyTypes.reserve(Capacity);
+    Transforms.reserve(Capacity);
+    Velocities.reserve(Capacity);
+    CollisionRects.reserve(Capacity);
+    SpriteFrames.reserve(Capacity);
+    Healths.reserve(Capacity);
+    EnemyAIStates.reserve(Capacity);
+    PendingDestroyFlags.reserve(Capacity);
+}
+
+/**
+ * @brief Создаёт врага.
+ *
+ * @param EnemyType Тип врага.
+ * @param StartPosition Начальная позиция врага.
+ * @param MaxPatrolDistance Дистанция патрулирования.
+ *
+ * @return Индекс созданной сущности.
+ */
+uint32_t AEntityComponentStore::CreateEnemy(EEnemyType EnemyType, const sf::Vector2f& StartPosition,
+                                            float MaxPatrolDistance)
+{
+    const uint32_t EntityIndex = static_cast<uint32_t>(EnemyTypes.size());
+
+    // Компоненты, зависящие от типа врага, заполняет SetEnemyType
+    EnemyTypes.emplace_back(EnemyType);
+    Transforms.emplace_back();
+    Velocities.emplace_back(0.f, 0.f);
+    CollisionRects.emplace_back();
+    SpriteFrames.emplace_back();
+    Healths.emplace_back();
+
+    // Враг патрулирует на половину дистанции в каждую сторону от начальной позиции
+    EnemyAIComponent EnemyAI;
+    EnemyAI.StartPosition = StartPosition;
+    EnemyAI.MinMoveDistance = MaxPatrolDistance / 2.f;
+    EnemyAI.MaxMoveDistance = MaxPatrolDistance / 2.f;
+    EnemyAIStates.emplace_back(EnemyAI);
+
+    PendingDestroyFlags.emplace_back(0);
+
+    SetEnemyType(EntityIndex, EnemyType);
+
+    return EntityIndex;
+}
+
+/**
+ * @brief Меняет тип врага и возвращает зависящие от типа компоненты к начальному состоянию.
+ *
+ * Позиция отрисовки и прямоугольник коллизии строятся от начальной позиции врага.
+ *
+ * @param EntityIndex Индекс сущности.
+ * @param EnemyType Новый тип врага.
+ */
+void AEntityComponentStore::SetEnemyType(uint32_t EntityIndex, EEnemyType EnemyType)
+{
+    const EnemyArchetype& Archetype = GetEnemyArchetype(EnemyType);
+    const sf::Vector2f& StartPosition = EnemyAIStates[EntityIndex].StartPosition;
+
+    EnemyTypes[EntityIndex] = EnemyType;
+
+    TransformComponent& Transform = Transforms[EntityIndex];
+    Transform.Position = {
+        StartPosition.x + (Archetype.EnemySize.x * DRAW_SCALE.x) / 2.f,
+        StartPosition.y + (Archetype.EnemySize.y * DRAW_SCALE.y) / 2.f
+    };
+    Transform.Scale = {Archetype.EnemyScale * DRAW_SCALE.x, Archetype.EnemyScale * DRAW_SCALE.y};
+
+    CollisionRects[EntityIndex] = {StartPosition, Archetype.EnemySize};
+
+    SpriteFrames[EntityIndex] = {Archetype.WalkClip->Frames.front(), 0.f};
+
+    Healths[EntityIndex] = {Archetype.MaxHealth, Archetype.MaxHealth};
+}
+
+/**
+ * @brief Получение количества сущностей.
+ *
+ * @return Количество сущностей.
+ */
+size_t AEntityComponentStore::GetEntityCount() const
+{
+    return EnemyTypes.size();
+}
+
+/**
+ * @brief Помечает сущность на уничтожение в конце кадра.
+ *
+ * @param EntityIndex Индекс сущности.
+ */
+void AEntityComponentStore::MarkEntityPendingDestroy(uint32_t EntityIndex)
+{
+    PendingDestroyFlags[EntityIndex] = 1;
+}
+
+/**
+ * @brief Проверяет, помечена ли сущность на уничтожение.
+ *
+ * @param EntityIndex Индекс сущности.
+ *
+ * @return true, если сущность будет удалена в конце кадра.
+ */
+bool AEntityComponentStore::IsEntityPendingDestroy(uint32_t EntityIndex) const
+{
+    return PendingDestroyFlags[EntityIndex] != 0;
+}
+
+/**
+ * @brief Удаляет помеченные сущности из всех массивов одним проходом, порядок оставшихся сохраняется.
+ */
+void AEntityComponentStore::DestroyPendingEntities()
+{
+    size_t WriteIndex = 0;
+
+    for (size_t ReadIndex = 0; ReadIndex < PendingDestroyFlags.size(); ++ReadIndex)
+    {
+        if (PendingDestroyFlags[ReadIndex])
+        {
+            continue;
+        }
+
+        // Сдвигаем оставшуюся сущность к началу, запись никогда не обгоняет чтение
+        if (WriteIndex != ReadIndex)
+        {
+            EnemyTypes[WriteIndex] = EnemyTypes[ReadIndex];
+            Transforms[WriteIndex] = Transforms[ReadIndex];
+            Velocities[WriteIndex] = Velocities[ReadIndex];
+            CollisionRects[WriteIndex] = CollisionRects[ReadIndex];
+            SpriteFrames[WriteIndex] = SpriteFrames[ReadIndex];
+            Healths[WriteIndex] = Healths[ReadIndex];
+            EnemyAIStates[WriteIndex] = EnemyAIStates[ReadIndex];
+            PendingDestroyFlags[WriteIndex] = 0;
+        }
+        ++WriteIndex;
+    }
+
+    EnemyTypes.resize(WriteIndex);
+    Transforms.resize(WriteIndex);
+    Velocities.resize(WriteIndex);
+    CollisionRects.resize(WriteIndex);
+    SpriteFrames.resize(WriteIndex);
+    Healths.resize(WriteIndex);
+    EnemyAIStates.resize(WriteIndex);
+    PendingDestroyFlags.resize(WriteIndex);
+}
+
+/**
+ * @brief Сохраняет все сущности в снимок.
+ *
+ * @param OutSnapshot Снимок, в который копируются массивы компонентов.
+ */
+void AEntityComponentStore::CaptureSnapshot(EntityStoreSnapshot& OutSnapshot) const
+{
+    OutSnapshot.EnemyTypes = EnemyTypes;
+    OutSnapshot.Transforms = Transforms;
+    OutSnapshot.Velocities = Velocities;
+    OutSnapshot.CollisionRects = CollisionRects;
+    OutSnapshot.SpriteFrames = SpriteFrames;
+    OutSnapshot.Healths = Healths;
+    OutSnapshot.EnemyAIStates = EnemyAIStates;
+}
+
+/**
+ * @brief Заменяет все сущности сущностями из снимка.
+ *
+ * @param Snapshot Снимок сущностей.
+ */
+void AEntityComponentStore::RestoreSnapshot(const EntityStoreSnapshot& Snapshot)
+{
+    EnemyTypes = Snapshot.EnemyTypes;
+    Transforms = Snapshot.Transforms;
+    Velocities = Snapshot.Velocities;
+    CollisionRects = Snapshot.CollisionRects;
+    SpriteFrames = Snapshot.SpriteFrames;
+    Healths = Snapshot.Healths;
+    EnemyAIStates = Snapshot.EnemyAIStates;
+
+    // В снимок попадают только живые сущности, пометок на уничтожение нет
+    PendingDestroyFlags.assign(EnemyTypes.size(), 0);
+}
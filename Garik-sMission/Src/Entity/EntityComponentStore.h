@@ -0,0 +1,213 @@
+﻿#pragma once
+#include "../Constants.h"
+#include "../Bullet/BulletPool.h"
+#include "../Manager/SpriteManager.h"
+
+/**
+ * @brief Тип врага, определяет его параметры (архетип).
+ */
+enum class EEnemyType
+{
+    EET_Green,
+    EET_Red,
+    EET_Blue,
+    EET_Boss
+};
+
+/**
+ * @brief Общие параметры всех врагов одного типа.
+ *
+ * Хранятся один раз на тип, сущности ссылаются на них через EEnemyType.
+ */
+struct EnemyArchetype
+{
+    const AnimationClip* WalkClip = nullptr;        // Клип анимации ходьбы (текстура, кадры и скорость)
+    sf::Vector2f EnemySize;                         // Размер прямоугольника коллизии
+    float EnemyScale = 1.f;                         // Масштаб спрайта врага
+    float MaxHealth = BASE_ENEMY_MAX_HEALTH;        // Максимальное здоровье
+    float Speed = ENEMY_SPEED;                      // Скорость патрулирования
+    float ShootingDelay = 0.5f;                     // Задержка между выстрелами
+    sf::Vector2f HealthBarSize = {10.f, 2.f};       // Размер шкалы здоровья
+    sf::IntRect BulletTextureRect;                  // Прямоугольник текстуры пули
+    float BulletDamage = BULLET_DAMAGE;             // Урон пули
+    EBulletDestroyEffect BulletDestroyEffect = EBulletDestroyEffect::EBDE_BulletDefaultDestroy; // Эффект уничтожения пули
+    float BulletOffsetY = 9.f;                      // Смещение точки вылета пули по Y
+    bool bDropsKeyOnDeath = false;                  // Оставляет ли враг ключ после смерти
+};
+
+/**
+ * @brief Компонент положения: позиция отрисовки (центр спрайта) и масштаб спрайта.
+ */
+struct TransformComponent
+{
+    sf::Vector2f Position;          // Позиция отрисовки
+    sf::Vector2f Scale = {1.f, 1.f}; // Масштаб спрайта, отрицательный X отражает спрайт
+};
+
+/**
+ * @brief Компонент кадра спрайта.
+ */
+struct SpriteFrameComponent
+{
+    sf::IntRect FrameRect;          // Текущий прямоугольник текстуры
+    float FrameIndex = 0.f;         // Текущий индекс кадра анимации ходьбы
+};
+
+/**
+ * @brief Компонент здоровья.
+ */
+struct HealthComponent
+{
+    float CurrentHealth = 0.f;      // Текущее здоровье
+    float MaxHealth = 0.f;          // Максимальное здоровье
+};
+
+/**
+ * @brief Компонент состояния поведения врага.
+ */
+struct EnemyAIComponent
+{
+    sf::Vector2f StartPosition;     // Начальная позиция, от неё отсчитывается дистанция патрулирования
+    float MinMoveDistance = 0.f;    // Дистанция патрулирования влево
+    float MaxMoveDistance = 0.f;    // Дистанция патрулирования вправо
+    float TimeAfterDetection = 0.f; // Время, прошедшее после потери персонажа из виду
+    float ShotTimer = 0.f;          // Время, прошедшее после последней попытки выстрела
+    bool bIsMoveRight = true;       // Флаг направления движения вправо
+    bool bIsPlayerDetected = false; // Флаг обнаружения персонажа
+};
+
+/**
+ * @brief Снимок всех сущностей хранилища: копия массивов компонентов.
+ */
+struct EntityStoreSnapshot
+{
+    std::vector<EEnemyType> EnemyTypes;                 // Тип (архетип) каждой сущности
+    std::vector<TransformComponent> Transforms;         // Позиция отрисовки и масштаб
+    std::vector<sf::Vector2f> Velocities;               // Скорость
+    std::vector<sf::FloatRect> CollisionRects;          // Прямоугольник коллизии
+    std::vector<SpriteFrameComponent> SpriteFrames;     // Кадр спрайта
+    std::vector<HealthComponent> Healths;               // Здоровье
+    std::vector<EnemyAIComponent> EnemyAIStates;        // Состояние поведения врага
+};
+
+/**
+ * @brief Хранилище сущностей в виде структуры массивов компонентов.
+ *
+ * Каждый компонент хранится в своём непрерывном массиве, индекс сущности одинаков во всех массивах,
+ * поэтому системы обходят только нужные им компоненты линейно, без указателей и виртуальных вызовов.
+ * Удаление помеченных сущностей выполняется одним проходом в конце кадра с сохранением порядка.
+ */
+class AEntityComponentStore
+{
+public:
+    /**
+     * @brief Конструктор класса AEntityComponentStore.
+     */
+    AEntityComponentStore() = default;
+
+    /**
+     * @brief Деструктор класса AEntityComponentStore.
+     */
+    ~AEntityComponentStore() = default;
+
+    /**
+     * @brief Заполняет параметры всех типов врагов.
+     *
+     * @param SpriteManager Менеджер спрайтов с кэшем текстур.
+     */
+    void InitEnemyArchetypes(ASpriteManager& SpriteManager);
+
+    /**
+     * @brief Получение параметров типа врага.
+     *
+     * @param EnemyType Тип врага.
+     *
+     * @return Параметры типа врага.
+     */
+    const EnemyArchetype& GetEnemyArchetype(EEnemyType EnemyType) const;
+
+    /**
+     * @brief Резервирует место под сущности во всех массивах компонентов.
+     *
+     * @param Capacity Количество сущностей.
+     */
+    void ReserveEntities(size_t Capacity);
+
+    /**
+     * @brief Создаёт врага.
+     *
+     * @param EnemyType Тип врага.
+     * @param StartPosition Начальная позиция врага.
+     * @param MaxPatrolDistance Дистанция патрулирования.
+     *
+     * @return Индекс созданной сущности.
+     */
+    uint32_t CreateEnemy(EEnemyType EnemyType, const sf::Vector2f& StartPosition, float MaxPatrolDistance);
+
+    /**
+     * @brief Меняет тип врага и возвращает зависящие от типа компоненты к начальному состоянию.
+     *
+     * Позиция отрисовки и прямоугольник коллизии строятся от начальной позиции врага.
+     *
+     * @param EntityIndex Индекс сущности.
+     * @param EnemyType Новый тип врага.
+     */
+    void SetEnemyType(uint32_t EntityIndex, EEnemyType EnemyType);
+
+    /**
+     * @brief Получение количества сущностей.
+     *
+     * @return Количество сущностей.
+     */
+    size_t GetEntityCount() const;
+
+    /**
+     * @brief Помечает сущность на уничтожение в конце кадра.
+     *
+     * @param EntityIndex Индекс сущности.
+     */
+    void MarkEntityPendingDestroy(uint32_t EntityIndex);
+
+    /**
+     * @brief Проверяет, помечена ли сущность на уничтожение.
+     *
+     * @param EntityIndex Индекс сущности.
+     *
+     * @return true, если сущность будет удалена в конце кадра.
+     */
+    bool IsEntityPendingDestroy(uint32_t EntityIndex) const;
+
+    /**
+     * @brief Удаляет помеченные сущности из всех массивов одним проходом, порядок оставшихся сохраняется.
+     */
+    void DestroyPendingEntities();
+
+    /**
+     * @brief Сохраняет все сущности в снимок.
+     *
+     * @param OutSnapshot Снимок, в который копируются массивы компонентов.
+     */
+    void CaptureSnapshot(EntityStoreSnapshot& OutSnapshot) const;
+
+    /**
+     * @brief Заменяет все сущности сущностями из снимка.
+     *
+     * Массивы компонентов копируются поверх текущих, поэтому при достаточной ёмкости память не выделяется.
+     *
+     * @param Snapshot Снимок сущностей.
+     */
+    void RestoreSnapshot(const EntityStoreSnapshot& Snapshot);
+
+public:
+    std::vector<EEnemyType> EnemyTypes;                 // Тип (архетип) каждой сущности
+    std::vector<TransformComponent> Transforms;         // Позиция отрисовки и масштаб
+    std::vector<sf::Vector2f> Velocities;               // Скорость
+    std::vector<sf::FloatRect> CollisionRects;          // Прямоугольник коллизии
+    std::vector<SpriteFrameComponent> SpriteFrames;     // Кадр спрайта
+    std::vector<HealthComponent> Healths;               // Здоровье
+    std::vector<EnemyAIComponent> EnemyAIStates;        // Состояние поведения врага
+
+private:
+    std::vector<uint8_t> PendingDestroyFlags;           // Пометки на уничтожение в конце кадра
+    std::vector<EnemyArchetype> EnemyArchetypes;        // Параметры типов врагов, индекс совпадает с EEnemyType
+};
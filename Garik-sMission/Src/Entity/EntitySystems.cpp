@@ -0,0 +1,278 @@
+﻿#include "EntitySystems.h"
+#include <algorithm>
+#include "../Manager/CollisionManager.h"
+
+/**
+ * @brief Обнаружение персонажа, выбор направления и скорости врагов.
+ *
+ * @param DeltaTime Время, прошедшее с последнего обновления.
+ * @param EntityStore Хранилище сущностей.
+ * @param Player Ссылка на персонажа.
+ * @param CollisionManager Менеджер коллизий для проверки видимости персонажа.
+ */
+void AEntitySystems::UpdateEnemyAISystem(float DeltaTime, AEntityComponentStore& EntityStore,
+                                         APlayer& Player, const ACollisionManager& CollisionManager)
+{
+    const sf::FloatRect& PlayerRect = Player.GetActorCollisionRect();
+    const sf::Vector2f& PlayerPosition = Player.GetActorPosition();
+
+    for (size_t i = 0; i < EntityStore.GetEntityCount(); ++i)
+    {
+        EnemyAIComponent& EnemyAI = EntityStore.EnemyAIStates[i];
+        sf::Vector2f& Velocity = EntityStore.Velocities[i];
+        const EnemyArchetype& Archetype = EntityStore.GetEnemyArchetype(EntityStore.EnemyTypes[i]);
+        const sf::Vector2f& EnemyPosition = EntityStore.Transforms[i].Position;
+
+        // Проверка, находится ли персонаж в зоне обнаружения врага
+        bool bPlayerVisible = false;
+        const sf::FloatRect DetectionArea(EnemyPosition - ENEMY_DETECTION_AREA_SIZE / 2.f, ENEMY_DETECTION_AREA_SIZE);
+        if (DetectionArea.intersects(PlayerRect))
+        {
+            // Пускаем луч от врага к игроку, если препятствий нет, враг видит игрока
+            RaycastHit Hit;
+            bPlayerVisible = !CollisionManager.Raycast(EnemyPosition, PlayerPosition, Hit);
+        }
+
+        if (bPlayerVisible)
+        {
+            EnemyAI.bIsPlayerDetected = true;
+            EnemyAI.TimeAfterDetection = 0.f;
+        }
+        else if (EnemyAI.TimeAfterDetection < ENEMY_DETECTION_TIMEOUT)
+        {
+            // Враг ещё некоторое время помнит, где был игрок
+            EnemyAI.TimeAfterDetection += DeltaTime;
+        }
+        else
+        {
+            EnemyAI.bIsPlayerDetected = false;
+        }
+
+        Velocity.y += GRAVITY * DeltaTime;
+
+        if (EnemyAI.bIsPlayerDetected)
+        {
+            // Враг останавливается и разворачивается к персонажу
+            Velocity.x = 0.f;
+            EnemyAI.bIsMoveRight = PlayerRect.left >= EntityStore.CollisionRects[i].left;
+        }
+        else
+        {
+            Velocity.x = EnemyAI.bIsMoveRight ? Archetype.Speed * DeltaTime : -Archetype.Speed * DeltaTime;
+        }
+
+        const float ScaleX = Archetype.EnemyScale * DRAW_SCALE.x;
+        EntityStore.Transforms[i].Scale = {EnemyAI.bIsMoveRight ? ScaleX : -ScaleX,
+                                           Archetype.EnemyScale * DRAW_SCALE.y};
+    }
+}
+
+/**
+ * @brief Обновляет кадр анимации ходьбы врагов, которые не видят персонажа.
+ *
+ * @param DeltaTime Время, прошедшее с последнего обновления.
+ * @param EntityStore Хранилище сущностей.
+ */
+void AEntitySystems::UpdateAnimationSystem(float DeltaTime, AEntityComponentStore& EntityStore)
+{
+    for (size_t i = 0; i < EntityStore.GetEntityCount(); ++i)
+    {
+        // Враг, который целится в персонажа, стоит на месте и не анимируется
+        if (EntityStore.EnemyAIStates[i].bIsPlayerDetected)
+        {
+            continue;
+        }
+
+        const EnemyArchetype& Archetype = EntityStore.GetEnemyArchetype(EntityStore.EnemyTypes[i]);
+        SpriteFrameComponent& SpriteFrame = EntityStore.SpriteFrames[i];
+
+        const AnimationClip& WalkClip = *Archetype.WalkClip;
+
+        SpriteFrame.FrameRect = WalkClip.Frames[static_cast<size_t>(SpriteFrame.FrameIndex)];
+
+        SpriteFrame.FrameIndex += WalkClip.FrameSpeed * DeltaTime;
+        if (SpriteFrame.FrameIndex >= static_cast<float>(WalkClip.Frames.size()))
+        {
+            SpriteFrame.FrameIndex = 0.f;
+        }
+    }
+}
+
+/**
+ * @brief Перемещает прямоугольники коллизии на скорость сущностей.
+ *
+ * @param EntityStore Хранилище сущностей.
+ */
+void AEntitySystems::UpdateMovementSystem(AEntityComponentStore& EntityStore)
+{
+    for (size_t i = 0; i < EntityStore.GetEntityCount(); ++i)
+    {
+        EntityStore.CollisionRects[i].left += EntityStore.Velocities[i].x;
+        EntityStore.CollisionRects[i].top -= EntityStore.Velocities[i].y;
+    }
+}
+
+/**
+ * @brief Разворачивает врагов, которые дошли до края дистанции патрулирования.
+ *
+ * @param EntityStore Хранилище сущностей.
+ */
+void AEntitySystems::UpdatePatrolSystem(AEntityComponentStore& EntityStore)
+{
+    for (size_t i = 0; i < EntityStore.GetEntityCount(); ++i)
+    {
+        EnemyAIComponent& EnemyAI = EntityStore.EnemyAIStates[i];
+
+        // Меняем направление движения только если персонаж не обнаружен
+        const float DistanceMoved = EntityStore.CollisionRects[i].left - EnemyAI.StartPosition.x;
+        if (!EnemyAI.bIsPlayerDetected &&
+            (DistanceMoved >= EnemyAI.MaxMoveDistance || DistanceMoved <= -EnemyAI.MinMoveDistance))
+        {
+            const EnemyArchetype& Archetype = EntityStore.GetEnemyArchetype(EntityStore.EnemyTypes[i]);
+            ChangeEnemyDirection(EnemyAI, EntityStore.Velocities[i], Archetype.Speed);
+        }
+    }
+}
+
+/**
+ * @brief Выталкивает сущности из препятствий карты, враги разворачиваются при столкновении сбоку.
+ *
+ * @param EntityStore Хранилище сущностей.
+ * @param CollisionManager Менеджер коллизий.
+ */
+void AEntitySystems::UpdateMapCollisionSystem(AEntityComponentStore& EntityStore,
+                                              const ACollisionManager& CollisionManager)
+{
+    for (size_t i = 0; i < EntityStore.GetEntityCount(); ++i)
+    {
+        if (CollisionManager.CheckCollisionWithGameMap(EntityStore.CollisionRects[i], EntityStore.Velocities[i]))
+        {
+            const EnemyArchetype& Archetype = EntityStore.GetEnemyArchetype(EntityStore.EnemyTypes[i]);
+            ChangeEnemyDirection(EntityStore.EnemyAIStates[i], EntityStore.Velocities[i], Archetype.Speed);
+        }
+    }
+}
+
+/**
+ * @brief Вычисляет позицию отрисовки по прямоугольнику коллизии.
+ *
+ * @param EntityStore Хранилище сущностей.
+ */
+void AEntitySystems::UpdateTransformSystem(AEntityComponentStore& EntityStore)
+{
+    for (size_t i = 0; i < EntityStore.GetEntityCount(); ++i)
+    {
+        const sf::FloatRect& Rect = EntityStore.CollisionRects[i];
+
+        EntityStore.Transforms[i].Position = {
+            Rect.left + (Rect.width * DRAW_SCALE.x) / 2.f,
+            Rect.top + (Rect.height * DRAW_SCALE.y) / 2.f
+        };
+    }
+}
+
+/**
+ * @brief Стрельба врагов, которые видят персонажа, с задержкой между выстрелами.
+ *
+ * @param DeltaTime Время, прошедшее с последнего обновления.
+ * @param EntityStore Хранилище сущностей.
+ * @param BulletsVectorPtr Вектор летящих пуль.
+ * @param BulletPool Пул пуль.
+ * @param SpriteManager Менеджер спрайтов.
+ */
+void AEntitySystems::UpdateEnemyShootingSystem(float DeltaTime, AEntityComponentStore& EntityStore,
+                                               std::vector<ABullet*>& BulletsVectorPtr,
+                                               ABulletPool& BulletPool,
+                                               ASpriteManager& SpriteManager)
+{
+    for (size_t i = 0; i < EntityStore.GetEntityCount(); ++i)
+    {
+        EnemyAIComponent& EnemyAI = EntityStore.EnemyAIStates[i];
+        const EnemyArchetype& Archetype = EntityStore.GetEnemyArchetype(EntityStore.EnemyTypes[i]);
+
+        EnemyAI.ShotTimer += DeltaTime;
+        if (EnemyAI.ShotTimer < Archetype.ShootingDelay)
+        {
+            continue;
+        }
+        EnemyAI.ShotTimer = 0.f;
+
+        // Выстрел из оружия, если персонаж обнаружен
+        if (!EnemyAI.bIsPlayerDetected)
+        {
+            continue;
+        }
+
+        const sf::FloatRect& Rect = EntityStore.CollisionRects[i];
+        const float SpawnBulletOffsetX = EnemyAI.bIsMoveRight ? Rect.width : 0.f;
+
+        ABullet* Bullet = BulletPool.AcquireBullet(EnemyAI.bIsMoveRight, BULLET_SPEED, Archetype.BulletDamage,
+                                                   Archetype.BulletTextureRect,
+                                                   EBulletType::EBT_ShootAtPlayer,
+                                                   Archetype.BulletDestroyEffect,
+                                                   sf::Vector2f(Rect.left + SpawnBulletOffsetX,
+                                                                Rect.top + Archetype.BulletOffsetY),
+                                                   SpriteManager);
+        if (Bullet)
+        {
+            BulletsVectorPtr.emplace_back(Bullet);
+        }
+    }
+}
+
+/**
+ * @brief Добавляет спрайты и шкалы здоровья всех сущностей в пакетную отрисовку.
+ *
+ * Спрайты попадают в слой персонажей, шкалы здоровья однотонными прямоугольниками в слой шкал здоровья.
+ *
+ * @param SpriteBatch Пакетная отрисовка кадра.
+ * @param EntityStore Хранилище сущностей.
+ */
+void AEntitySystems::BatchEntitySystem(ASpriteBatch& SpriteBatch, const AEntityComponentStore& EntityStore) const
+{
+    // Цвета шкалы здоровья врагов
+    const sf::Color HealthBarFillColor = sf::Color::Red;
+    const sf::Color HealthBarBackgroundColor = sf::Color(181, 184, 177);
+
+    for (size_t i = 0; i < EntityStore.GetEntityCount(); ++i)
+    {
+        const EnemyArchetype& Archetype = EntityStore.GetEnemyArchetype(EntityStore.EnemyTypes[i]);
+        const TransformComponent& Transform = EntityStore.Transforms[i];
+        const sf::IntRect& FrameRect = EntityStore.SpriteFrames[i].FrameRect;
+
+        // Центр спрайта совпадает с позицией отрисовки, отрицательный масштаб по X отражает кадр
+        const sf::Vector2f SpriteSize = {
+            static_cast<float>(FrameRect.width) * std::abs(Transform.Scale.x),
+            static_cast<float>(FrameRect.height) * Transform.Scale.y
+        };
+        SpriteBatch.AddQuad(*Archetype.WalkClip->Texture, {Transform.Position - SpriteSize / 2.f, SpriteSize}, FrameRect,
+                            Transform.Scale.x < 0.f, ERenderLayer::ERL_Characters);
+
+        // Шкала здоровья чуть выше врага, заполнение растёт от левого края
+        const sf::FloatRect& Rect = EntityStore.CollisionRects[i];
+        const HealthComponent& Health = EntityStore.Healths[i];
+        const sf::Vector2f BarPosition = {
+            Rect.left + Rect.width / 2.f - Archetype.HealthBarSize.x / 2.f,
+            Rect.top - 4.f - Archetype.HealthBarSize.y / 2.f
+        };
+        const float HealthPercentage = std::clamp(Health.CurrentHealth / Health.MaxHealth, 0.f, 1.f);
+
+        SpriteBatch.AddSolidQuad({BarPosition, Archetype.HealthBarSize}, HealthBarBackgroundColor,
+                                 ERenderLayer::ERL_HealthBars);
+        SpriteBatch.AddSolidQuad({BarPosition, {Archetype.HealthBarSize.x * HealthPercentage, Archetype.HealthBarSize.y}},
+                                 HealthBarFillColor, ERenderLayer::ERL_HealthBars);
+    }
+}
+
+/**
+ * @brief Разворачивает врага в обратную сторону.
+ *
+ * @param EnemyAI Состояние поведения врага.
+ * @param Velocity Скорость врага.
+ * @param Speed Скорость патрулирования врага.
+ */
+void AEntitySystems::ChangeEnemyDirection(EnemyAIComponent& EnemyAI, sf::Vector2f& Velocity, float Speed)
+{
+    EnemyAI.bIsMoveRight = !EnemyAI.bIsMoveRight;
+    Velocity.x = EnemyAI.bIsMoveRight ? Speed : -Speed;
+}
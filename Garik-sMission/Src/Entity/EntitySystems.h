@@ -0,0 +1,109 @@
+﻿#pragma once
+#include "EntityComponentStore.h"
+#include "../Manager/SpriteBatch.h"
+
+// Предварительное объявление (Forward declaration)
+class APlayer;
+class ACollisionManager;
+
+/**
+ * @brief Системы, которые обновляют и отрисовывают сущности хранилища компонентов.
+ *
+ * Каждая система проходит линейно по нужным ей массивам компонентов всех сущностей.
+ * Порядок вызова систем за кадр: поведение, анимация, перемещение, патрулирование, коллизии с картой, положение.
+ */
+class AEntitySystems
+{
+public:
+    /**
+     * @brief Конструктор класса AEntitySystems.
+     */
+    AEntitySystems() = default;
+
+    /**
+     * @brief Деструктор класса AEntitySystems.
+     */
+    ~AEntitySystems() = default;
+
+    /**
+     * @brief Обнаружение персонажа, выбор направления и скорости врагов.
+     *
+     * @param DeltaTime Время, прошедшее с последнего обновления.
+     * @param EntityStore Хранилище сущностей.
+     * @param Player Ссылка на персонажа.
+     * @param CollisionManager Менеджер коллизий для проверки видимости персонажа.
+     */
+    void UpdateEnemyAISystem(float DeltaTime, AEntityComponentStore& EntityStore,
+                             APlayer& Player, const ACollisionManager& CollisionManager);
+
+    /**
+     * @brief Обновляет кадр анимации ходьбы врагов, которые не видят персонажа.
+     *
+     * @param DeltaTime Время, прошедшее с последнего обновления.
+     * @param EntityStore Хранилище сущностей.
+     */
+    void UpdateAnimationSystem(float DeltaTime, AEntityComponentStore& EntityStore);
+
+    /**
+     * @brief Перемещает прямоугольники коллизии на скорость сущностей.
+     *
+     * @param EntityStore Хранилище сущностей.
+     */
+    void UpdateMovementSystem(AEntityComponentStore& EntityStore);
+
+    /**
+     * @brief Разворачивает врагов, которые дошли до края дистанции патрулирования.
+     *
+     * @param EntityStore Хранилище сущностей.
+     */
+    void UpdatePatrolSystem(AEntityComponentStore& EntityStore);
+
+    /**
+     * @brief Выталкивает сущности из препятствий карты, враги разворачиваются при столкновении сбоку.
+     *
+     * @param EntityStore Хранилище сущностей.
+     * @param CollisionManager Менеджер коллизий.
+     */
+    void UpdateMapCollisionSystem(AEntityComponentStore& EntityStore, const ACollisionManager& CollisionManager);
+
+    /**
+     * @brief Вычисляет позицию отрисовки по прямоугольнику коллизии.
+     *
+     * @param EntityStore Хранилище сущностей.
+     */
+    void UpdateTransformSystem(AEntityComponentStore& EntityStore);
+
+    /**
+     * @brief Стрельба врагов, которые видят персонажа, с задержкой между выстрелами.
+     *
+     * @param DeltaTime Время, прошедшее с последнего обновления.
+     * @param EntityStore Хранилище сущностей.
+     * @param BulletsVectorPtr Вектор летящих пуль.
+     * @param BulletPool Пул пуль.
+     * @param SpriteManager Менеджер спрайтов.
+     */
+    void UpdateEnemyShootingSystem(float DeltaTime, AEntityComponentStore& EntityStore,
+                                   std::vector<ABullet*>& BulletsVectorPtr,
+                                   ABulletPool& BulletPool,
+                                   ASpriteManager& SpriteManager);
+
+    /**
+     * @brief Добавляет спрайты и шкалы здоровья всех сущностей в пакетную отрисовку.
+     *
+     * Спрайты попадают в слой персонажей, шкалы здоровья однотонными прямоугольниками в слой шкал здоровья.
+     *
+     * @param SpriteBatch Пакетная отрисовка кадра.
+     * @param EntityStore Хранилище сущностей.
+     */
+    void BatchEntitySystem(ASpriteBatch& SpriteBatch, const AEntityComponentStore& EntityStore) const;
+
+private:
+    /**
+     * @brief Разворачивает врага в обратную сторону.
+     *
+     * @param EnemyAI Состояние поведения врага.
+     * @param Velocity Скорость врага.
+     * @param Speed Скорость патрулирования врага.
+     */
+    static void ChangeEnemyDirection(EnemyAIComponent& EnemyAI, sf::Vector2f& Velocity, float Speed);
+};
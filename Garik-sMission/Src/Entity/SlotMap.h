@@ -0,0 +1,181 @@
+﻿#pragma once
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Индекс, который не указывает ни на один слот.
+ */
+constexpr uint32_t INVALID_SLOT_INDEX = UINT32_MAX;
+
+/**
+ * @brief Дескриптор объекта в карте слотов: индекс слота и поколение.
+ *
+ * Поколение слота увеличивается при каждом удалении объекта, поэтому дескриптор
+ * удалённого объекта перестаёт находить что-либо, даже если слот уже занят новым объектом.
+ */
+struct EntityHandle
+{
+    uint32_t Index = INVALID_SLOT_INDEX;    // Индекс слота
+    uint32_t Generation = 0;                // Поколение слота на момент создания объекта
+
+    /**
+     * @brief Проверка, был ли дескриптор когда-либо выдан картой слотов.
+     *
+     * @return true, если дескриптор не пустой (объект при этом может быть уже удалён).
+     */
+    bool IsValid() const { return Index != INVALID_SLOT_INDEX; }
+
+    bool operator==(const EntityHandle& Other) const = default;
+};
+
+/**
+ * @brief Карта слотов, которая владеет объектами и выдаёт на них дескрипторы с поколением.
+ *
+ * Объекты хранятся в слотах непрерывного массива, освобождённые слоты переиспользуются через список свободных.
+ * Другие подсистемы хранят не указатели, а дескрипторы и получают объект через Get,
+ * который возвращает nullptr для удалённого объекта, поэтому обращение к освобождённой памяти невозможно.
+ * Указатель, полученный через Get, действителен только до следующего Insert.
+ */
+template <typename T>
+class TSlotMap
+{
+public:
+    /**
+     * @brief Резервирует слоты.
+     *
+     * @param Capacity Количество слотов.
+     */
+    void Reserve(size_t Capacity)
+    {
+        Slots.reserve(Capacity);
+    }
+
+    /**
+     * @brief Создаёт объект в свободном слоте.
+     *
+     * @param Args Аргументы конструктора объекта.
+     *
+     * @return Дескриптор созданного объекта.
+     */
+    template <typename... ArgsType>
+    EntityHandle Insert(ArgsType&&... Args)
+    {
+        uint32_t SlotIndex;
+        if (FreeSlotIndex != INVALID_SLOT_INDEX)
+        {
+            SlotIndex = FreeSlotIndex;
+            FreeSlotIndex = Slots[SlotIndex].NextFreeIndex;
+        }
+        else
+        {
+            SlotIndex = static_cast<uint32_t>(Slots.size());
+            Slots.emplace_back();
+        }
+
+        Slot& NewSlot = Slots[SlotIndex];
+        NewSlot.Object.emplace(std::forward<ArgsType>(Args)...);
+        NewSlot.NextFreeIndex = INVALID_SLOT_INDEX;
+
+        return {SlotIndex, NewSlot.Generation};
+    }
+
+    /**
+     * @brief Получение объекта по дескриптору.
+     *
+     * @param Handle Дескриптор объекта.
+     *
+     * @return Указатель на объект или nullptr, если объект уже удалён.
+     */
+    T* Get(EntityHandle Handle)
+    {
+        return Contains(Handle) ? &*Slots[Handle.Index].Object : nullptr;
+    }
+
+    /**
+     * @brief Получение объекта по дескриптору.
+     *
+     * @param Handle Дескриптор объекта.
+     *
+     * @return Указатель на объект или nullptr, если объект уже удалён.
+     */
+    const T* Get(EntityHandle Handle) const
+    {
+        return Contains(Handle) ? &*Slots[Handle.Index].Object : nullptr;
+    }
+
+    /**
+     * @brief Проверка, существует ли объект дескриптора.
+     *
+     * @param Handle Дескриптор объекта.
+     *
+     * @return true, если объект существует.
+     */
+    bool Contains(EntityHandle Handle) const
+    {
+        return Handle.Index < Slots.size()
+            && Slots[Handle.Index].Generation == Handle.Generation
+            && Slots[Handle.Index].Object.has_value();
+    }
+
+    /**
+     * @brief Удаляет объект, все его дескрипторы становятся недействительными.
+     *
+     * @param Handle Дескриптор объекта.
+     *
+     * @return true, если объект был удалён, false, если его уже не было.
+     */
+    bool Remove(EntityHandle Handle)
+    {
+        if (!Contains(Handle))
+        {
+            return false;
+        }
+
+        FreeSlot(Handle.Index);
+        return true;
+    }
+
+    /**
+     * @brief Удаляет все объекты, все выданные дескрипторы становятся недействительными.
+     */
+    void Clear()
+    {
+        for (uint32_t SlotIndex = 0; SlotIndex < Slots.size(); ++SlotIndex)
+        {
+            if (Slots[SlotIndex].Object.has_value())
+            {
+                FreeSlot(SlotIndex);
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Слот карты.
+     */
+    struct Slot
+    {
+        std::optional<T> Object;                        // Объект слота, пусто для свободного слота
+        uint32_t Generation = 0;                        // Поколение, увеличивается при удалении объекта
+        uint32_t NextFreeIndex = INVALID_SLOT_INDEX;    // Следующий свободный слот
+    };
+
+    /**
+     * @brief Уничтожает объект слота и добавляет слот в список свободных.
+     *
+     * @param SlotIndex Индекс слота.
+     */
+    void FreeSlot(uint32_t SlotIndex)
+    {
+        Slot& FreedSlot = Slots[SlotIndex];
+        FreedSlot.Object.reset();
+        ++FreedSlot.Generation;
+        FreedSlot.NextFreeIndex = FreeSlotIndex;
+        FreeSlotIndex = SlotIndex;
+    }
+
+    std::vector<Slot> Slots;                            // Слоты объектов
+    uint32_t FreeSlotIndex = INVALID_SLOT_INDEX;        // Первый свободный слот
+};
@@ -13,12 +13,17 @@ AGameState::AGameState()
       CreditsScreenPtr(new ACreditsScreen),
       PlayerPtr(new APlayer),
       GameMapPtr(new AGameMap),
+      EntityStorePtr(new AEntityComponentStore),
+      EntitySystemsPtr(new AEntitySystems),
+      BulletPoolPtr(new ABulletPool),
       SpriteManagerPtr(new ASpriteManager),
       CollisionManagerPtr(new ACollisionManager(*this, *PlayerPtr, *GameMapPtr)),
       ParticleSystemPtr(new AParticleSystemManager),
+      SpriteBatchPtr(new ASpriteBatch),
       SoundManagerPtr(new ASoundManager),
       GameTextPtr(new AUIText),
       MenuPtr(new AMenu),
+      LevelArenaPtr(new ALevelArena),
       //FpsManagerPtr(new AFpsManager), // TODO: используется для тестирования производительности
       CurrentGameState(EGameState::EGS_Menu),
       PastGameState(EGameState::EGS_Menu)
@@ -75,6 +80,11 @@ AGameState::~AGameState()
         delete ParticleSystemPtr;
         ParticleSystemPtr = nullptr;
     }
+    if (SpriteBatchPtr)
+    {
+        delete SpriteBatchPtr;
+        SpriteBatchPtr = nullptr;
+    }
     if (SoundManagerPtr)
     {
         delete SoundManagerPtr;
@@ -96,41 +106,37 @@ AGameState::~AGameState()
         FinalGatePtr = nullptr;
     }
 
-    // Очищаем вектор врагов
-    for (auto& Enemy : EnemyVectorPtr)
+    // Удаляем хранилище врагов и их системы
+    if (EntityStorePtr)
     {
-        delete Enemy;
+        delete EntityStorePtr;
+        EntityStorePtr = nullptr;
     }
-    EnemyVectorPtr.clear();
-
-    // Очищаем вектор пуль
-    for (auto& Bullet : BulletsVectorPtr)
+    if (EntitySystemsPtr)
     {
-        delete Bullet;
+        delete EntitySystemsPtr;
+        EntitySystemsPtr = nullptr;
     }
-    BulletsVectorPtr.clear();
 
-    // Очищаем вектор ключей
-    for (auto& Key : KeysVectorPtr)
+    // Пули принадлежат пулу и удаляются вместе с ним
+    BulletsVectorPtr.clear();
+    if (BulletPoolPtr)
     {
-        delete Key;
+        delete BulletPoolPtr;
+        BulletPoolPtr = nullptr;
     }
-    KeysVectorPtr.clear();
-    FoundKeysVectorPtr.clear();
 
-    // Очищаем вектор сундуков
-    for (auto& Chest : ChestVectorPtr)
-    {
-        delete Chest;
-    }
+    // Ключи принадлежат карте слотов, сундуки и лечащие объекты арене уровня, они уничтожаются вместе с ними
+    KeyHandles.clear();
+    FoundKeyHandles.clear();
+    KeySlotMap.Clear();
     ChestVectorPtr.clear();
-
-    // Очищаем вектор восстанавливающих здоровье объектов
-    for (auto& HealingHam : HealingHamVectorPtr)
+    HealingHamVectorPtr.clear();
+    if (LevelArenaPtr)
     {
-        delete HealingHam;
+        delete LevelArenaPtr;
+        LevelArenaPtr = nullptr;
     }
-    HealingHamVectorPtr.clear();
 }
 
 /**
@@ -143,85 +149,61 @@ void AGameState::InitGame()
     // Вместимость вектора врагов
     constexpr int CapacityVectorEnemy = 40;
 
-    // Вместимость вектора пуль
-    constexpr int CapacityVectorBullet = 20;
-
     // Вместимость вектора ключей
     constexpr int CapacityVectorKey = 3;
 
-    DialoguePtr->InitDialogue();
+    // Атлас загружается до текстур, чтобы листы из него сразу выдавались страницами атласа
+    SpriteManagerPtr->InitTextureAtlas(TEXTURE_ATLAS_PATH);
+
+    DialoguePtr->InitDialogue(*SpriteManagerPtr);
     GameOverPtr->InitGameOver(*SpriteManagerPtr);
     CreditsScreenPtr->InitCreditsScreen(*SpriteManagerPtr);
-    ParticleSystemPtr->InitParticleSystem();
+    ParticleSystemPtr->InitParticleSystem(*SpriteManagerPtr);
     PlayerPtr->InitPlayer(*SpriteManagerPtr);
     GameMapPtr->InitGameMap();
+    BulletPoolPtr->InitBulletPool(*SpriteManagerPtr);
     SoundManagerPtr->InitSoundGame();
     // FpsManagerPtr->InitFpsText(); // TODO: используется для тестирования производительности
     GameTextPtr->InitGameText();
-    MenuPtr->InitMenu();
+    MenuPtr->InitMenu(*SpriteManagerPtr);
     FinalGatePtr->InitFinalGate(*SpriteManagerPtr);
 
-    // Резервирование места для врагов
-    EnemyVectorPtr.reserve(CapacityVectorEnemy);
-
-    // Для случайного появления врагов из 3 видов
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<int> dist(0, 2);
+    // Параметры типов врагов и резервирование места для врагов
+    EntityStorePtr->InitEnemyArchetypes(*SpriteManagerPtr);
+    EntityStorePtr->ReserveEntities(CapacityVectorEnemy);
 
+    // Тип обычных врагов выбирается случайно в RollBaseEnemyTypes
     for (const sf::Vector2f& EnemyPosition : GameMapPtr->GetSpawnBaseEnemyPositionVector())
     {
-        int EnemyType = dist(gen);
         float MaxPatrolDistance = 80.f;
-        AEnemy* BaseEnemy = nullptr;
-
-        switch (EnemyType)
-        {
-        case 0:
-            // Зеленый враг
-            BaseEnemy = new ABaseGreenEnemy(MaxPatrolDistance, EnemyPosition);
-            break;
-
-        case 1:
-            // Красный враг
-            BaseEnemy = new ABaseRedEnemy(MaxPatrolDistance, EnemyPosition);
-            break;
-
-        case 2:
-            // Синий враг
-            BaseEnemy = new ABaseBlueEnemy(MaxPatrolDistance, EnemyPosition);
-            break;
-
-        default:
-            BaseEnemy = nullptr;
-            break;
-        }
-
-        if (BaseEnemy)
-        {
-            BaseEnemy->InitEnemy(*SpriteManagerPtr);
-            EnemyVectorPtr.emplace_back(BaseEnemy);
-        }
+        EntityStorePtr->CreateEnemy(EEnemyType::EET_Green, EnemyPosition, MaxPatrolDistance);
     }
+    RollBaseEnemyTypes();
 
     for (const sf::Vector2f& BossPosition : GameMapPtr->GetSpawnBossEnemyPositionVector())
     {
         float MaxPatrolDistance = 80.f;
-        AEnemy* Boss = new ABossEnemy(MaxPatrolDistance, BossPosition); // Указать начальную позицию врага
-        Boss->InitEnemy(*SpriteManagerPtr);
-        EnemyVectorPtr.emplace_back(Boss);
+        EntityStorePtr->CreateEnemy(EEnemyType::EET_Boss, BossPosition, MaxPatrolDistance);
     }
 
     // Резервирование места для пуль
-    BulletsVectorPtr.reserve(CapacityVectorBullet);
+    BulletsVectorPtr.reserve(BULLET_POOL_CAPACITY);
 
     // Резервирование места для ключей
-    KeysVectorPtr.reserve(CapacityVectorKey);
+    KeySlotMap.Reserve(CapacityVectorKey);
+    KeyHandles.reserve(CapacityVectorKey);
+    FoundKeyHandles.reserve(CapacityVectorKey);
+
+    // Объекты прошлого уровня освобождаются из арены одной операцией, её блоки памяти переиспользуются
+    ChestVectorPtr.clear();
+    HealingHamVectorPtr.clear();
+    LevelArenaPtr->ResetArena();
+    AChestObject::ChestCount = 1;
 
     // Указать начальную позицию сундуков
     for (const sf::Vector2f& ChestPosition : GameMapPtr->GetSpawnChestPositionVector())
     {
-        AChestObject* Chest = new AChestObject(ChestPosition);
+        AChestObject* Chest = LevelArenaPtr->CreateObject<AChestObject>(ChestPosition);
         Chest->InitChest(*SpriteManagerPtr);
         ChestVectorPtr.emplace_back(std::move(Chest));
         ++AChestObject::ChestCount;
@@ -230,10 +212,64 @@ void AGameState::InitGame()
     // Указать начальную позицию лечащих объектов(ветчины)
     for (const sf::Vector2f& HealingPosition : GameMapPtr->GetSpawnHealingObjectsPositionVector())
     {
-        AHealthObject* HealingHam = new AHealthObject(HealingPosition);
+        AHealthObject* HealingHam = LevelArenaPtr->CreateObject<AHealthObject>(HealingPosition);
         HealingHam->InitHealthObject(*SpriteManagerPtr);
         HealingHamVectorPtr.emplace_back(std::move(HealingHam));
     }
+
+    // Текстуры, которые остались только в кэше (например, от прошлой карты), больше не нужны
+    SpriteManagerPtr->ReleaseUnusedTextures();
+
+    // Запоминаем начальное состояние мира для быстрого перезапуска
+    CaptureWorldSnapshot();
+}
+
+/**
+* @brief Сохраняет начальное состояние мира в снимок.
+*/
+void AGameState::CaptureWorldSnapshot()
+{
+    EntityStorePtr->CaptureSnapshot(InitialWorldSnapshot.Enemies);
+    GameMapPtr->GetDynamicObstacleLayer().CaptureObstacleStates(InitialWorldSnapshot.DynamicObstacleStates);
+    InitialWorldSnapshot.PlayerCollisionRect = PlayerPtr->GetActorCollisionRect();
+    InitialWorldSnapshot.bIsCaptured = true;
+}
+
+/**
+* @brief Восстанавливает состояние мира из снимка.
+*/
+void AGameState::RestoreWorldSnapshot()
+{
+    if (!InitialWorldSnapshot.bIsCaptured)
+    {
+        throw std::runtime_error("Error: World snapshot was not captured before restart");
+    }
+
+    EntityStorePtr->RestoreSnapshot(InitialWorldSnapshot.Enemies);
+
+    // Как и при загрузке уровня, обычные враги при каждом перезапуске получают новый случайный тип
+    RollBaseEnemyTypes();
+    GameMapPtr->GetDynamicObstacleLayer().RestoreObstacleStates(InitialWorldSnapshot.DynamicObstacleStates);
+    PlayerPtr->GetActorCollisionRect() = InitialWorldSnapshot.PlayerCollisionRect;
+}
+
+/**
+* @brief Выбирает случайный тип (зелёный, красный или синий) для каждого обычного врага, боссы не меняются.
+*/
+void AGameState::RollBaseEnemyTypes()
+{
+    // Для случайного появления врагов из 3 видов
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<int> dist(0, 2);
+
+    for (uint32_t EntityIndex = 0; EntityIndex < EntityStorePtr->GetEntityCount(); ++EntityIndex)
+    {
+        if (EntityStorePtr->EnemyTypes[EntityIndex] != EEnemyType::EET_Boss)
+        {
+            EntityStorePtr->SetEnemyType(EntityIndex, static_cast<EEnemyType>(dist(gen)));
+        }
+    }
 }
 
 /**
@@ -247,46 +283,35 @@ void AGameState::StartGame()
 
 /**
 * @brief Сбрасывает состояние игры, например, для перезапуска.
+* 
+* Карта, текстуры, звуки и объекты уровня остаются загруженными, изменяемое состояние
+* возвращается к начальному, а враги, препятствия карты и позиция персонажа берутся из снимка мира.
 */
 void AGameState::ResetGame()
 {
-    // Очищаем вектор врагов
-    for (auto& Enemy : EnemyVectorPtr)
-    {
-        delete Enemy;
-    }
-    EnemyVectorPtr.clear();
+    // Возвращаем все пули в пул
+    BulletPoolPtr->ReleaseAllBullets(BulletsVectorPtr);
 
-    // Очищаем вектор пуль
-    for (auto& Bullet : BulletsVectorPtr)
-    {
-        delete Bullet;
-    }
-    BulletsVectorPtr.clear();
+    // Убираем проигрывающиеся эффекты частиц, пулы эффектов остаются
+    ParticleSystemPtr->ClearParticleEffects();
 
-    // Очищаем вектор ключей
-    for (auto& FoundKey : FoundKeysVectorPtr)
-    {
-        FoundKey->ResetKey();
-        delete FoundKey;
-    }
-    FoundKeysVectorPtr.clear();
-    KeysVectorPtr.clear();
+    // Ключи появляются только во время игры, поэтому все удаляются, выданные на них дескрипторы становятся недействительными
+    FoundKeyHandles.clear();
+    KeyHandles.clear();
+    KeySlotMap.Clear();
+    AKeyObject::KeysCount = 0;
+    AKeyObject::KeysCountFound = 0;
 
-    // Очищаем векток сундуков
+    // Сундуки и лечащие объекты остаются в арене уровня и только возвращаются в начальное состояние
     for (auto& Chest : ChestVectorPtr)
     {
-        Chest->ResetChestObject();
-        delete Chest;
+        Chest->CloseChest();
     }
-    ChestVectorPtr.clear();
 
     for (auto& HealingHam : HealingHamVectorPtr)
     {
         HealingHam->ResetHealObjectState();
-        delete HealingHam;
     }
-    HealingHamVectorPtr.clear();
 
     // Сбрасываем состояние игрока
     if (PlayerPtr)
@@ -294,11 +319,6 @@ void AGameState::ResetGame()
         PlayerPtr->ResetPlayer();
     }
 
-    if (GameMapPtr)
-    {
-        GameMapPtr->ResetGameMap();
-    }
-
     if (GameOverPtr)
     {
         GameOverPtr->ResetGameOverPosition();
@@ -309,8 +329,12 @@ void AGameState::ResetGame()
         CreditsScreenPtr->ResetCreditsScreen();
     }
 
-    // Инициализируем игру заново
-    InitGame();
+    FinalGatePtr->ResetFinalGate();
+    DialoguePtr->ResetDialogue();
+    SoundManagerPtr->ResetSoundState();
+
+    // Враги, препятствия карты и стартовая позиция персонажа
+    RestoreWorldSnapshot();
 }
 
 /**
@@ -414,21 +438,22 @@ void AGameState::SetGameState(const EGameState& NewGameState)
     case EGameState::EGS_Playing:
         {
             // Останавливаем музыку меню, если она играет
-            if (SoundManagerPtr->GetSound("MenuMusic").Playing || SoundManagerPtr->GetSound("Helicopter").Playing)
+            if (SoundManagerPtr->GetMusic("MenuMusic").getStatus() == sf::SoundSource::Playing ||
+                SoundManagerPtr->GetMusic("Helicopter").getStatus() == sf::SoundSource::Playing)
             {
                 SoundManagerPtr->StopSound("MenuMusic");
                 SoundManagerPtr->StopSound("Helicopter");
             }
 
             // Продолжаем воспроизведение фоновой музыки, если она уже играет
-            if (SoundManagerPtr->GetSound("BackgroundMusic").getStatus() == sf::SoundSource::Paused)
+            if (SoundManagerPtr->GetMusic("BackgroundMusic").getStatus() == sf::SoundSource::Paused)
             {
                 SoundManagerPtr->PlaySound("BackgroundMusic"); // Продолжаем воспроизведение если на паузе
             }
-            else if (SoundManagerPtr->GetSound("BackgroundMusic").getStatus() == sf::SoundSource::Stopped)
+            else if (SoundManagerPtr->GetMusic("BackgroundMusic").getStatus() == sf::SoundSource::Stopped)
             {
                 // Запускаем фоновую музыку если она не играла
-                SoundManagerPtr->GetSound("BackgroundMusic").setLoop(true); // Запуск фоновой музыки на повторе
+                SoundManagerPtr->GetMusic("BackgroundMusic").setLoop(true); // Запуск фоновой музыки на повторе
                 SoundManagerPtr->PlaySound("BackgroundMusic");
             }
             break;
@@ -437,15 +462,15 @@ void AGameState::SetGameState(const EGameState& NewGameState)
     case EGameState::EGS_Menu:
         {
             // Останавливаем фоновую музыку, если она играет
-            if (SoundManagerPtr->GetSound("BackgroundMusic").Playing)
+            if (SoundManagerPtr->GetMusic("BackgroundMusic").getStatus() == sf::SoundSource::Playing)
             {
                 SoundManagerPtr->StopSound("BackgroundMusic");
             }
 
             // Воспроизводим музыку меню, если она ещё не играет
-            if (SoundManagerPtr->GetSound("MenuMusic").getStatus() == sf::SoundSource::Stopped)
+            if (SoundManagerPtr->GetMusic("MenuMusic").getStatus() == sf::SoundSource::Stopped)
             {
-                SoundManagerPtr->GetSound("MenuMusic").setLoop(true); // Запуск музыки меню на повторе
+                SoundManagerPtr->GetMusic("MenuMusic").setLoop(true); // Запуск музыки меню на повторе
                 SoundManagerPtr->PlaySound("MenuMusic");
             }
             break;
@@ -454,20 +479,20 @@ void AGameState::SetGameState(const EGameState& NewGameState)
     case EGameState::EGS_IntroDialogue:
         {
             // Останавливаем музыку меню, если она играет
-            if (SoundManagerPtr->GetSound("MenuMusic").Playing)
+            if (SoundManagerPtr->GetMusic("MenuMusic").getStatus() == sf::SoundSource::Playing)
             {
                 SoundManagerPtr->StopSound("MenuMusic");
             }
 
             // Запускаем звук Helicopter
-            if (SoundManagerPtr->GetSound("Helicopter").getStatus() == sf::SoundSource::Paused)
+            if (SoundManagerPtr->GetMusic("Helicopter").getStatus() == sf::SoundSource::Paused)
             {
                 SoundManagerPtr->PlaySound("Helicopter"); // Продолжаем воспроизведение если на паузе
             }
-            else if (SoundManagerPtr->GetSound("Helicopter").getStatus() == sf::SoundSource::Stopped)
+            else if (SoundManagerPtr->GetMusic("Helicopter").getStatus() == sf::SoundSource::Stopped)
             {
                 // Запускаем звук Helicopter, если он не играл
-                SoundManagerPtr->GetSound("Helicopter").setLoop(true); // Запуск Helicopter на повторе
+                SoundManagerPtr->GetMusic("Helicopter").setLoop(true); // Запуск Helicopter на повторе
                 SoundManagerPtr->PlaySound("Helicopter");
             }
             break;
@@ -511,6 +536,7 @@ void AGameState::UpdateInput(float DeltaTime)
             if (ElapsedSecondsForPlayer > 0.4f)
             {
                 PlayerPtr->HandlePlayerShoots(BulletsVectorPtr,
+                                              *BulletPoolPtr,
                                               *SoundManagerPtr,
                                               *SpriteManagerPtr,
                                               *ParticleSystemPtr);
@@ -520,19 +546,9 @@ void AGameState::UpdateInput(float DeltaTime)
             }
         }
 
-        // Задержка между выстрелами для врагов
-        for (auto& Enemy : EnemyVectorPtr)
-        {
-            float ElapsedSecondsForEnemy = Enemy->GetDelayShotTimerHandle().getElapsedTime().asSeconds();
-            if (ElapsedSecondsForEnemy >= Enemy->GetShootingDelay())
-            {
-                // Воспроизводим выстрел
-                Enemy->EnemyShoot(9.f, BulletsVectorPtr, *SpriteManagerPtr);
-
-                // Сброс таймера задержки между выстрелами
-                Enemy->GetDelayShotTimerHandle().restart();
-            }
-        }
+        // Стрельба врагов с задержкой между выстрелами
+        EntitySystemsPtr->UpdateEnemyShootingSystem(DeltaTime, *EntityStorePtr, BulletsVectorPtr,
+                                                    *BulletPoolPtr, *SpriteManagerPtr);
     }
 }
 
@@ -546,6 +562,9 @@ void AGameState::UpdateInput(float DeltaTime)
  */
 void AGameState::UpdateGameplay(float DeltaTime)
 {
+    // Новый кадр для звуков: одинаковые звуковые эффекты внутри кадра объединяются
+    SoundManagerPtr->UpdateSoundManager();
+
     switch (CurrentGameState)
     {
     case EGameState::EGS_Playing:
@@ -587,11 +606,13 @@ void AGameState::UpdateGameplay(float DeltaTime)
                 );
             }
 
-            // Обновление движения врагов
-            for (auto Enemy : EnemyVectorPtr)
-            {
-                Enemy->UpdateEnemyMove(DeltaTime, *PlayerPtr, *GameMapPtr, *CollisionManagerPtr);
-            }
+            // Обновление врагов: каждая система проходит по своим компонентам всех врагов
+            EntitySystemsPtr->UpdateEnemyAISystem(DeltaTime, *EntityStorePtr, *PlayerPtr, *CollisionManagerPtr);
+            EntitySystemsPtr->UpdateAnimationSystem(DeltaTime, *EntityStorePtr);
+            EntitySystemsPtr->UpdateMovementSystem(*EntityStorePtr);
+            EntitySystemsPtr->UpdatePatrolSystem(*EntityStorePtr);
+            EntitySystemsPtr->UpdateMapCollisionSystem(*EntityStorePtr, *CollisionManagerPtr);
+            EntitySystemsPtr->UpdateTransformSystem(*EntityStorePtr);
 
             // Обновление движения пуль
             for (auto Bullet : BulletsVectorPtr)
@@ -602,8 +623,9 @@ void AGameState::UpdateGameplay(float DeltaTime)
             // Проверка столкновений пуль
             CollisionManagerPtr->CheckAllBulletCollisions(
                 BulletsVectorPtr,
-                EnemyVectorPtr,
-                KeysVectorPtr,
+                *EntityStorePtr,
+                KeySlotMap,
+                KeyHandles,
                 *PlayerPtr,
                 *SpriteManagerPtr,
                 *SoundManagerPtr,
@@ -611,7 +633,7 @@ void AGameState::UpdateGameplay(float DeltaTime)
             );
 
             // Проверка столкновения персонажа с ключами
-            CollisionManagerPtr->CheckCollisionWithKey(KeysVectorPtr, *SoundManagerPtr);
+            CollisionManagerPtr->CheckCollisionWithKey(KeySlotMap, KeyHandles, *SoundManagerPtr);
 
             // TODO: используется для тестирования производительности
             // Обновление отображения FPS
@@ -623,10 +645,13 @@ void AGameState::UpdateGameplay(float DeltaTime)
             // Обновления состояния эффектов
             ParticleSystemPtr->UpdateParticleSystem(DeltaTime);
 
+            // Обновление анимированных тайлов карты
+            GameMapPtr->UpdateGameMap(DeltaTime);
+
             // Если все сундуки открыты, то устанавливаем текстуру открытых ворот
             if (AChestObject::ChestOpenCountStatic == OPEN_ALL_CHESTS)
             {
-                FinalGatePtr->UpdateStateFinalGate();
+                FinalGatePtr->UpdateStateFinalGate(*GameMapPtr);
                 SoundManagerPtr->PlaySound("OpenGate");
 
                 // Увеличиваем счётчик, чтобы не попадать в условие снова
@@ -634,13 +659,18 @@ void AGameState::UpdateGameplay(float DeltaTime)
             }
 
             // Обновления гравитации и состояния ключа
-            for (auto& Key : KeysVectorPtr)
+            for (const EntityHandle& KeyHandle : KeyHandles)
             {
+                AKeyObject* Key = KeySlotMap.Get(KeyHandle);
+                if (!Key)
+                {
+                    continue;
+                }
+
                 Key->UpdateMoveKey(DeltaTime);
                 CollisionManagerPtr->CheckCollisionWithGameMap(
                     Key->GetActorCollisionRect(),
-                    Key->GetActorVelocity(),
-                    nullptr
+                    Key->GetActorVelocity()
                 );
             }
 
@@ -651,17 +681,22 @@ void AGameState::UpdateGameplay(float DeltaTime)
                 if (CollisionManagerPtr->CheckCollision(PlayerPtr->GetActorCollisionRect(),
                                                         Chest->GetActorCollisionRect()))
                 {
-                    for (auto it = FoundKeysVectorPtr.begin(); it != FoundKeysVectorPtr.end();)
+                    for (auto it = FoundKeyHandles.begin(); it != FoundKeyHandles.end();)
                     {
-                        AKeyObject* Key = *it;
-                        if (!Chest->GetOpenChest() && Chest->CanOpenWithKey(Key->GetKeyID()))
+                        const AKeyObject* Key = KeySlotMap.Get(*it);
+                        if (!Key)
+                        {
+                            it = FoundKeyHandles.erase(it); // Ключ уже удалён, дескриптор больше не нужен
+                        }
+                        else if (!Chest->GetOpenChest() && Chest->CanOpenWithKey(Key->GetKeyID()))
                         {
                             SoundManagerPtr->PlaySound("OpenChest");
                             Chest->OpenChest(); // Открываем сундук
                             Chest->IncreaseOpenChestCounter(); // Увеличение счетчика открытых сундуков
 
-                            delete Key; // Удаляем объект ключа
-                            it = FoundKeysVectorPtr.erase(it); // Удаляем элемент из вектора и получаем новый итератор
+                            // Удаляем ключ, его дескрипторы больше ничего не находят
+                            KeySlotMap.Remove(*it);
+                            it = FoundKeyHandles.erase(it); // Удаляем элемент из вектора и получаем новый итератор
 
                             break; // Прерываем цикл после открытия сундука и удаления ключа
                         }
@@ -687,6 +722,10 @@ void AGameState::UpdateGameplay(float DeltaTime)
                 }
             }
 
+            // Возвращаем уничтоженные за кадр пули в пул и удаляем убитых врагов, одним проходом по каждому вектору
+            BulletPoolPtr->ReleasePendingBullets(BulletsVectorPtr);
+            EntityStorePtr->DestroyPendingEntities();
+
             break;
         }
     case EGameState::EGS_IntroDialogue:
@@ -816,9 +855,12 @@ void AGameState::UpdateCamera(sf::RenderWindow& Window)
                     ViewPlayer.getCenter().x - (ViewPlayer.getSize().x / 2.f) + 195.f,
                     ViewPlayer.getCenter().y - (ViewPlayer.getSize().y / 2.f) - 2.f));
 
-                for (auto& Key : FoundKeysVectorPtr)
+                for (const EntityHandle& FoundKeyHandle : FoundKeyHandles)
                 {
-                    Key->MakrKeyInTopRightCorner(ViewPlayer);
+                    if (AKeyObject* Key = KeySlotMap.Get(FoundKeyHandle))
+                    {
+                        Key->MakrKeyInTopRightCorner(ViewPlayer);
+                    }
                 }
             }
             break;
@@ -905,50 +947,61 @@ void AGameState::UpdateCamera(sf::RenderWindow& Window)
  * 
  * @param Window Окно игры для отрисовки объектов.
  */
-void AGameState::DrawGame(sf::RenderWindow& Window) const
+void AGameState::DrawGame(sf::RenderWindow& Window)
 {
     // Отрисовка карты, объектов и персонажей - общий для всех состояний код
     GameMapPtr->DrawGameMap(Window);
 
     ParticleSystemPtr->DrawParticleSystem(Window);
 
+    // Объекты, персонажи, пули и интерфейс собираются в пакеты по слою и текстуре и рисуются за несколько вызовов
+    SpriteBatchPtr->BeginBatch();
+
     for (const auto& Chest : ChestVectorPtr)
     {
-        Chest->DrawActor(Window);
+        Chest->BatchActor(*SpriteBatchPtr, ERenderLayer::ERL_Objects);
     }
 
-    FinalGatePtr->DrawActor(Window);
-    PlayerPtr->DrawActor(Window);
+    FinalGatePtr->BatchActor(*SpriteBatchPtr, ERenderLayer::ERL_Objects);
 
-    for (auto& Enemy : EnemyVectorPtr)
+    for (const auto& HealingHam : HealingHamVectorPtr)
     {
-        Enemy->DrawActor(Window);
+        HealingHam->BatchActor(*SpriteBatchPtr, ERenderLayer::ERL_Objects);
     }
 
-    for (auto& Bullet : BulletsVectorPtr)
+    // Ключи, лежащие на карте, относятся к объектам, а найденные показываются в интерфейсе
+    for (const EntityHandle& KeyHandle : KeyHandles)
     {
-        Bullet->DrawActor(Window);
+        if (const AKeyObject* Key = KeySlotMap.Get(KeyHandle))
+        {
+            Key->BatchActor(*SpriteBatchPtr, ERenderLayer::ERL_Objects);
+        }
     }
 
-    // TODO: используется для тестирования производительности
-    // FpsManagerPtr->DrawFpsText(Window);
-
-    GameTextPtr->DrawGameText(Window);
-
-    for (auto& Key : KeysVectorPtr)
+    for (const EntityHandle& FoundKeyHandle : FoundKeyHandles)
     {
-        Key->DrawActor(Window);
+        if (const AKeyObject* Key = KeySlotMap.Get(FoundKeyHandle))
+        {
+            Key->BatchActor(*SpriteBatchPtr, ERenderLayer::ERL_HUD);
+        }
     }
 
-    for (auto& Key : FoundKeysVectorPtr)
-    {
-        Key->DrawActor(Window);
-    }
-    for (const auto& HealingHam : HealingHamVectorPtr)
+    PlayerPtr->BatchActor(*SpriteBatchPtr, ERenderLayer::ERL_Characters);
+
+    EntitySystemsPtr->BatchEntitySystem(*SpriteBatchPtr, *EntityStorePtr);
+
+    for (const auto& Bullet : BulletsVectorPtr)
     {
-        HealingHam->DrawActor(Window);
+        Bullet->BatchActor(*SpriteBatchPtr, ERenderLayer::ERL_Bullets);
     }
 
+    GameTextPtr->BatchGameText(*SpriteBatchPtr);
+
+    SpriteBatchPtr->FlushBatch(Window);
+
+    // TODO: используется для тестирования производительности
+    // FpsManagerPtr->DrawFpsText(Window);
+
     if (CurrentGameState != EGameState::EGS_Playing)
     {
         // Проверка состояния игры
@@ -1031,14 +1084,14 @@ sf::View AGameState::GetViewPlayer() const
 }
 
 /**
- * @brief Получение вектора найденных ключей.
+ * @brief Получение вектора дескрипторов найденных ключей.
  * 
- * Этот метод возвращает ссылку на вектор найденных ключей.
- * Позволяет модифицировать оригинальный вектор, содержащий найденные ключи.
+ * Этот метод возвращает ссылку на вектор дескрипторов найденных ключей.
+ * Позволяет модифицировать оригинальный вектор, сами ключи принадлежат карте слотов ключей.
  * 
- * @return Возвращает ссылку на вектор найденных ключей.
+ * @return Возвращает ссылку на вектор дескрипторов найденных ключей.
  */
-std::vector<AKeyObject*>& AGameState::GetFoundKeysVector()
+std::vector<EntityHandle>& AGameState::GetFoundKeyHandles()
 {
-    return FoundKeysVectorPtr;
+    return FoundKeyHandles;
 }
@@ -3,7 +3,9 @@
 #include <SFML/Graphics/View.hpp>
 #include "../Manager/CollisionManager.h"
 #include "../Manager/FpsManager.h"
+#include "../Manager/LevelArena.h"
 #include "../Manager/ParticleSystemManager.h"
+#include "../Manager/SpriteBatch.h"
 
 // Подключаем разные состояния игры
 #include "IntroDialogue.h"
@@ -20,11 +22,9 @@
 #include "../GameObjects/ChestObject.h"
 #include "../GameObjects/HealthObject.h"
 
-// Подключаем типов врагов
-#include "../Enemy/BossEnemy/BossEnemy.h"
-#include "../Enemy/BaseEnemy/BaseRedEnemy.h"
-#include "../Enemy/BaseEnemy/BaseBlueEnemy.h"
-#include "../Enemy/BaseEnemy/BaseGreenEnemy.h"
+// Подключаем хранилище сущностей и системы для врагов
+#include "../Entity/EntitySystems.h"
+#include "../Entity/SlotMap.h"
 
 /**
  * @brief Перечисление, определяющее различные состояния игры
@@ -42,6 +42,19 @@ enum class EGameState
     EGS_Exit,
 };
 
+/**
+ * @brief Снимок изменяемого состояния мира сразу после загрузки уровня.
+ *
+ * Перезапуск восстанавливает мир из снимка, не разбирая карту и не загружая ресурсы заново.
+ */
+struct WorldSnapshot
+{
+    EntityStoreSnapshot Enemies;                    // Враги в начальном состоянии
+    std::vector<uint8_t> DynamicObstacleStates;     // Включены ли динамические препятствия карты
+    sf::FloatRect PlayerCollisionRect;              // Стартовый прямоугольник коллизии персонажа
+    bool bIsCaptured = false;                       // Флаг, сделан ли снимок
+};
+
 /**
  * @brief Класс AGameState представляет текущее состояние игры.
  * Он управляет инициализацией игры, обновлением ввода, игрового процесса, камеры и отрисовкой.
@@ -126,7 +139,7 @@ public:
      * 
      * @param Window Окно для отрисовки игры.
      */
-    void DrawGame(sf::RenderWindow& Window) const;
+    void DrawGame(sf::RenderWindow& Window);
  
     /**
      * @brief Получает текущее состояние игры (игровой процесс активен или нет).
@@ -164,13 +177,28 @@ public:
     sf::View GetViewPlayer() const;
 
     /**
-    * @brief Ссылка на вектор указателей на найденые ключи.
+    * @brief Ссылка на вектор дескрипторов найденных ключей.
     * 
-    * @return Возвращает вектор ключей.
+    * @return Возвращает вектор дескрипторов ключей.
     */
-    std::vector<AKeyObject*>& GetFoundKeysVector();
+    std::vector<EntityHandle>& GetFoundKeyHandles();
 
 private:
+    /**
+     * @brief Сохраняет начальное состояние мира в снимок.
+     */
+    void CaptureWorldSnapshot();
+
+    /**
+     * @brief Восстанавливает состояние мира из снимка.
+     */
+    void RestoreWorldSnapshot();
+
+    /**
+     * @brief Выбирает случайный тип (зелёный, красный или синий) для каждого обычного врага, боссы не меняются.
+     */
+    void RollBaseEnemyTypes();
+
     bool bIsGamePlaying;                                     // Флаг, указывающий, идет ли игровой процесс.
 
     AIntroDialogue* DialoguePtr;                             // Указатель на диалог при старте игры.
@@ -179,22 +207,28 @@ private:
 
     APlayer* PlayerPtr;                                      // Указатель на игрока.
     AGameMap* GameMapPtr;                                    // Указатель на игровую карту.
-    std::vector<AEnemy*> EnemyVectorPtr;                     // Вектор врагов.
+    AEntityComponentStore* EntityStorePtr;                   // Хранилище компонентов врагов.
+    AEntitySystems* EntitySystemsPtr;                        // Системы обновления и отрисовки врагов.
     std::vector<ABullet*> BulletsVectorPtr;                  // Вектор пуль.
+    ABulletPool* BulletPoolPtr;                              // Пул пуль, которым принадлежат все пули вектора пуль.
 
     ASpriteManager* SpriteManagerPtr;                        // Менеджер спрайтов.
     ACollisionManager* CollisionManagerPtr;                  // Менеджер коллизий.
     AParticleSystemManager* ParticleSystemPtr;               // Менеджер частиц.
+    ASpriteBatch* SpriteBatchPtr;                            // Пакетная отрисовка объектов, персонажей и интерфейса.
     ASoundManager* SoundManagerPtr;                          // Менеджер звуков.
     // AFpsManager* FpsManagerPtr;                           // Менеджер FPS. // TODO: Используется только тестов.
 
     AUIText* GameTextPtr;                                    // Текст для отображения состояния игры.
     AMenu* MenuPtr;                                          // Меню игры.
     AFinalGateObject* FinalGatePtr;                          // Финальные ворота, которые открываются по завершении миссии.
-    std::vector<AKeyObject*> KeysVectorPtr;                  // Вектор ключей для выполнения миссий.
-    std::vector<AKeyObject*> FoundKeysVectorPtr;             // Вектор указателей на ключи, которые найдены
+    ALevelArena* LevelArenaPtr;                              // Арена уровня, из неё создаются сундуки и лечащие объекты.
+    TSlotMap<AKeyObject> KeySlotMap;                         // Карта слотов, которая владеет ключами для выполнения миссий.
+    std::vector<EntityHandle> KeyHandles;                    // Дескрипторы ключей, которые ещё не подобраны.
+    std::vector<EntityHandle> FoundKeyHandles;               // Дескрипторы ключей, которые найдены.
     std::vector<AChestObject*> ChestVectorPtr;               // Вектор сундуков для выполнения миссий.
     std::vector<AHealthObject*> HealingHamVectorPtr;         // Вектор объектов для восстановления здоровья.
+    WorldSnapshot InitialWorldSnapshot;                      // Снимок мира после загрузки уровня, из него делается перезапуск.
 
     EGameState CurrentGameState;                             // Текущее состояние игры.
     EGameState PastGameState;                                // Предыдущее состояние игры.
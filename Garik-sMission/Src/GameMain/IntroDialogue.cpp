@@ -16,42 +16,27 @@ AIntroDialogue::AIntroDialogue()
 * @brief Инициализация диалога.
 * 
 * Устанавливает начальные параметры и состояние анимации диалога.
+* 
+* @param SpriteManager Менеджер спрайтов с кэшем текстур.
 */
-void AIntroDialogue::InitDialogue()
+void AIntroDialogue::InitDialogue(ASpriteManager& SpriteManager)
 {
-    if (!DialogueAnimation.FrameRect.empty())
-    {
-        bDialogueFinished = false;
-        DialogueAnimation.ResetAnimation();
-    }
-
-    // Загружаем текстуру картинки
-    if (!DialogueAnimation.AnimTexture.loadFromFile(ASSETS_PATH + "MainTiles/IntroDialogue.png"))
-    {
-        throw std::runtime_error("Error: Failed to load texture: " + ASSETS_PATH + "MainTiles/IntroDialogue.png");
-    }
-
-    ActorSprite.setTexture(DialogueAnimation.AnimTexture);
-
-    // Добавляем картинки в вектор
-    //DialogueAnimation.FrameSpeed = 0.2f;
-    DialogueAnimation.FrameRect.emplace_back(sf::IntRect(0, -2, static_cast<int>(ActorSize.x),
-                                                         static_cast<int>(ActorSize.y)));
-
-    DialogueAnimation.FrameRect.emplace_back(sf::IntRect(0, static_cast<int>(ActorSize.y),
-                                                         static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-
-    DialogueAnimation.FrameRect.emplace_back(sf::IntRect(0, static_cast<int>(ActorSize.y * 2),
-                                                         static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-
-    DialogueAnimation.FrameRect.emplace_back(sf::IntRect(0, static_cast<int>(ActorSize.y * 3),
-                                                         static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-
-    DialogueAnimation.FrameRect.emplace_back(sf::IntRect(0, static_cast<int>(ActorSize.y * 4),
-                                                         static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-
-    DialogueAnimation.FrameRect.emplace_back(sf::IntRect(0, static_cast<int>(ActorSize.y * 5),
-                                                         static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
+    // Кадры диалога, переключаются кликом мыши, поэтому скорость смены кадров 0
+    const int DialogueFrameWidth = static_cast<int>(ActorSize.x);
+    const int DialogueFrameHeight = static_cast<int>(ActorSize.y);
+    const std::vector<sf::IntRect> DialogueFrames = {
+        sf::IntRect(0, -2, DialogueFrameWidth, DialogueFrameHeight),
+        sf::IntRect(0, DialogueFrameHeight, DialogueFrameWidth, DialogueFrameHeight),
+        sf::IntRect(0, DialogueFrameHeight * 2, DialogueFrameWidth, DialogueFrameHeight),
+        sf::IntRect(0, DialogueFrameHeight * 3, DialogueFrameWidth, DialogueFrameHeight),
+        sf::IntRect(0, DialogueFrameHeight * 4, DialogueFrameWidth, DialogueFrameHeight),
+        sf::IntRect(0, DialogueFrameHeight * 5, DialogueFrameWidth, DialogueFrameHeight)
+    };
+
+    DialogueAnimation.SetAnimationClip(SpriteManager.LoadAnimationClip(
+        "IntroDialogue", ASSETS_PATH + "MainTiles/IntroDialogue.png", DialogueFrames, 0.f));
+
+    ActorSprite.setTexture(DialogueAnimation.GetAnimationTexture());
 
     DialogueAnimation.SetStopAtLastFrame(true);
 
@@ -65,6 +50,18 @@ void AIntroDialogue::InitDialogue()
     MouseSprite.setTexture(MouseTexture);
 }
 
+/**
+* @brief Возвращает диалог к первому кадру.
+* 
+* Клип анимации и текстуры остаются загруженными.
+*/
+void AIntroDialogue::ResetDialogue()
+{
+    bDialogueFinished = false;
+    DialogueAnimation.ResetAnimation();
+    DialogueAnimation.SetStopAtLastFrame(true);
+}
+
 /**
 * @brief Проверяет завершен ли диалог.
 * 
@@ -101,7 +98,7 @@ void AIntroDialogue::SwitchNextFrame(const sf::Event& Event, ASoundManager& Soun
     float ElapsedSeconds = DelayBetweenMessages.getElapsedTime().asSeconds();
 
     // Переходим к следующему кадру, если это не последний кадр
-    if (DialogueAnimation.GetCurrentFrameIndex() < DialogueAnimation.FrameRect.size() - 1)
+    if (DialogueAnimation.GetCurrentFrameIndex() < DialogueAnimation.GetFrameCount() - 1)
     {
         if (Event.type == sf::Event::MouseButtonPressed && Event.mouseButton.button == sf::Mouse::Left)
         {
@@ -26,8 +26,17 @@ public:
      * @brief Инициализация диалога.
      * 
      * Устанавливает начальные параметры и состояние анимации диалога.
+     * 
+     * @param SpriteManager Менеджер спрайтов с кэшем текстур.
+     */
+    void InitDialogue(ASpriteManager& SpriteManager);
+
+    /**
+     * @brief Возвращает диалог к первому кадру.
+     * 
+     * Клип анимации и текстуры остаются загруженными.
      */
-    void InitDialogue();
+    void ResetDialogue();
 
     /**
      * @brief Проверяет завершен ли диалог.
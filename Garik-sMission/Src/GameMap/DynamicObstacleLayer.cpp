@@ -0,0 +1,135 @@
+﻿#include "DynamicObstacleLayer.h"
+
+/**
+ * @brief Инициализация слоя для области карты.
+ *
+ * @param MapBounds Область карты, которую покрывает сетка слоя.
+ */
+void ADynamicObstacleLayer::InitDynamicObstacleLayer(const sf::FloatRect& MapBounds)
+{
+    Obstacles.clear();
+    ObstacleRectSoA.ClearRectSoA();
+    ObstacleGrid.InitGrid(MapBounds, COLLISION_GRID_CELL_SIZE);
+}
+
+/**
+ * @brief Регистрирует новое динамическое препятствие.
+ *
+ * @param ObstacleName Имя препятствия.
+ * @param ObstacleRect Прямоугольник коллизии препятствия.
+ * @param bIsEnabled Включено ли препятствие сразу.
+ *
+ * @return Идентификатор зарегистрированного препятствия.
+ */
+uint32_t ADynamicObstacleLayer::AddObstacle(const std::string& ObstacleName,
+                                            const sf::FloatRect& ObstacleRect,
+                                            bool bIsEnabled)
+{
+    const uint32_t ObstacleID = static_cast<uint32_t>(Obstacles.size());
+    Obstacles.push_back({ObstacleID, ObstacleName, ObstacleRect, bIsEnabled});
+    ObstacleRectSoA.AddRect(ObstacleRect);
+
+    if (bIsEnabled)
+    {
+        ObstacleGrid.InsertRect(ObstacleID, ObstacleRect);
+    }
+
+    return ObstacleID;
+}
+
+/**
+ * @brief Включает или выключает препятствие.
+ *
+ * @param ObstacleID Идентификатор препятствия.
+ * @param bIsEnabled true, чтобы включить препятствие, false, чтобы выключить.
+ */
+void ADynamicObstacleLayer::SetObstacleEnabled(uint32_t ObstacleID, bool bIsEnabled)
+{
+    if (ObstacleID >= Obstacles.size() || Obstacles[ObstacleID].bIsEnabled == bIsEnabled)
+    {
+        return;
+    }
+
+    DynamicObstacle& Obstacle = Obstacles[ObstacleID];
+    Obstacle.bIsEnabled = bIsEnabled;
+
+    // Обновляем только ячейки сетки, которые покрывает это препятствие
+    if (bIsEnabled)
+    {
+        ObstacleGrid.InsertRect(ObstacleID, Obstacle.ObstacleRect);
+    }
+    else
+    {
+        ObstacleGrid.RemoveRect(ObstacleID, Obstacle.ObstacleRect);
+    }
+}
+
+/**
+ * @brief Ищет препятствие по имени.
+ *
+ * @param ObstacleName Имя препятствия.
+ *
+ * @return Идентификатор препятствия или INVALID_OBSTACLE_ID, если препятствие не найдено.
+ */
+uint32_t ADynamicObstacleLayer::FindObstacleID(const std::string& ObstacleName) const
+{
+    for (const DynamicObstacle& Obstacle : Obstacles)
+    {
+        if (Obstacle.ObstacleName == ObstacleName)
+        {
+            return Obstacle.ObstacleID;
+        }
+    }
+
+    return INVALID_OBSTACLE_ID;
+}
+
+/**
+ * @brief Собирает идентификаторы включённых препятствий, которые пересекают область.
+ *
+ * @param Area Область запроса.
+ * @param OutObstacleIDs Вектор, в который записываются идентификаторы (предварительно очищается).
+ */
+void ADynamicObstacleLayer::QueryObstacles(const sf::FloatRect& Area, std::vector<uint32_t>& OutObstacleIDs) const
+{
+    ObstacleGrid.QueryRect(Area, OutObstacleIDs);
+    ObstacleRectSoA.FilterIntersecting(Area, OutObstacleIDs);
+}
+
+/**
+ * @brief Получение всех зарегистрированных препятствий.
+ *
+ * @return Вектор препятствий, индекс совпадает с идентификатором.
+ */
+const std::vector<DynamicObstacle>& ADynamicObstacleLayer::GetObstacles() const
+{
+    return Obstacles;
+}
+
+/**
+ * @brief Сохраняет состояние (включено или выключено) всех препятствий.
+ *
+ * @param OutStates Состояния препятствий, индекс совпадает с идентификатором.
+ */
+void ADynamicObstacleLayer::CaptureObstacleStates(std::vector<uint8_t>& OutStates) const
+{
+    OutStates.resize(Obstacles.size());
+    for (size_t i = 0; i < Obstacles.size(); ++i)
+    {
+        OutStates[i] = Obstacles[i].bIsEnabled ? 1 : 0;
+    }
+}
+
+/**
+ * @brief Восстанавливает состояние всех препятствий, сетка обновляется только для изменившихся.
+ *
+ * @param States Состояния препятствий, индекс совпадает с идентификатором.
+ */
+void ADynamicObstacleLayer::RestoreObstacleStates(const std::vector<uint8_t>& States)
+{
+    const size_t ObstacleCount = std::min(States.size(), Obstacles.size());
+    for (size_t i = 0; i < ObstacleCount; ++i)
+    {
+        SetObstacleEnabled(static_cast<uint32_t>(i), States[i] != 0);
+    }
+}
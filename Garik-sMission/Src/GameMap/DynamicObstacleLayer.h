@@ -0,0 +1,111 @@
+﻿#pragma once
+#include <limits>
+#include "../Constants.h"
+#include "SpatialGrid.h"
+#include "RectSoA.h"
+
+/**
+ * @brief Динамическое препятствие карты (дверь, ворота, разрушаемая стена).
+ */
+struct DynamicObstacle
+{
+    uint32_t ObstacleID = 0;        // Идентификатор препятствия (индекс в слое)
+    std::string ObstacleName;       // Имя объекта из слоя DynamicObstacles карты
+    sf::FloatRect ObstacleRect;     // Прямоугольник коллизии препятствия
+    bool bIsEnabled = true;         // Участвует ли препятствие в коллизиях
+};
+
+/**
+ * @brief Слой динамических препятствий карты.
+ *
+ * Препятствия регистрируются при загрузке карты и могут включаться и выключаться во время игры.
+ * Сетка содержит только включённые препятствия и обновляется при переключении одного препятствия,
+ * статические коллизии карты при этом не изменяются.
+ */
+class ADynamicObstacleLayer
+{
+public:
+    /**
+     * @brief Идентификатор, который возвращается, если препятствие не найдено.
+     */
+    static constexpr uint32_t INVALID_OBSTACLE_ID = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief Конструктор класса ADynamicObstacleLayer.
+     */
+    ADynamicObstacleLayer() = default;
+
+    /**
+     * @brief Деструктор класса ADynamicObstacleLayer.
+     */
+    ~ADynamicObstacleLayer() = default;
+
+    /**
+     * @brief Инициализация слоя для области карты.
+     *
+     * @param MapBounds Область карты, которую покрывает сетка слоя.
+     */
+    void InitDynamicObstacleLayer(const sf::FloatRect& MapBounds);
+
+    /**
+     * @brief Регистрирует новое динамическое препятствие.
+     *
+     * @param ObstacleName Имя препятствия.
+     * @param ObstacleRect Прямоугольник коллизии препятствия.
+     * @param bIsEnabled Включено ли препятствие сразу.
+     *
+     * @return Идентификатор зарегистрированного препятствия.
+     */
+    uint32_t AddObstacle(const std::string& ObstacleName, const sf::FloatRect& ObstacleRect, bool bIsEnabled = true);
+
+    /**
+     * @brief Включает или выключает препятствие.
+     *
+     * @param ObstacleID Идентификатор препятствия.
+     * @param bIsEnabled true, чтобы включить препятствие, false, чтобы выключить.
+     */
+    void SetObstacleEnabled(uint32_t ObstacleID, bool bIsEnabled);
+
+    /**
+     * @brief Ищет препятствие по имени.
+     *
+     * @param ObstacleName Имя препятствия.
+     *
+     * @return Идентификатор препятствия или INVALID_OBSTACLE_ID, если препятствие не найдено.
+     */
+    uint32_t FindObstacleID(const std::string& ObstacleName) const;
+
+    /**
+     * @brief Собирает идентификаторы включённых препятствий, которые пересекают область.
+     *
+     * @param Area Область запроса.
+     * @param OutObstacleIDs Вектор, в который записываются идентификаторы (предварительно очищается).
+     */
+    void QueryObstacles(const sf::FloatRect& Area, std::vector<uint32_t>& OutObstacleIDs) const;
+
+    /**
+     * @brief Получение всех зарегистрированных препятствий.
+     *
+     * @return Вектор препятствий, индекс совпадает с идентификатором.
+     */
+    const std::vector<DynamicObstacle>& GetObstacles() const;
+
+    /**
+     * @brief Сохраняет состояние (включено или выключено) всех препятствий.
+     *
+     * @param OutStates Состояния препятствий, индекс совпадает с идентификатором.
+     */
+    void CaptureObstacleStates(std::vector<uint8_t>& OutStates) const;
+
+    /**
+     * @brief Восстанавливает состояние всех препятствий, сетка обновляется только для изменившихся.
+     *
+     * @param States Состояния препятствий, индекс совпадает с идентификатором.
+     */
+    void RestoreObstacleStates(const std::vector<uint8_t>& States);
+
+private:
+    std::vector<DynamicObstacle> Obstacles;     // Зарегистрированные препятствия
+    ASpatialGrid ObstacleGrid;                  // Сетка включённых препятствий
+    ARectSoA ObstacleRectSoA;                   // Границы всех препятствий по массивам для пакетной проверки
+};
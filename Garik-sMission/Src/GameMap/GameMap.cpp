@@ -1,4 +1,5 @@
 ﻿#include "GameMap.h"
+#include <iostream>
 
 /**
 * @brief Деструктор класса.
@@ -7,19 +8,12 @@
 */
 AGameMap::~AGameMap()
 {
-    // Очищаем текстуры тайлов
-    TilesetTextures.clear();
-
-    // Очищаем массивы вершин
-    LayersVector.clear();
-
-    // Очищаем состояния отрисовки
-    RenderStatesVector.clear();
+    // Очищаем чанки и текстуры тайлов
+    TileMapRenderer.ClearTileMapRenderer();
 
     // Очищаем слои коллизий карты
     GameMapCollisionLayer.clear();
-    LadderCollisionLayer.clear();
-    LavaDamageCollisionLayer.clear();
+    TriggerVolumeLayer.ClearTriggerVolumes();
 
     // Очищаем вектора позиций спавна врагов и сундуков
     SpawnBaseEnemyPosition.clear();
@@ -37,7 +31,6 @@ void AGameMap::InitGameMap()
     // Резервируем место для коллизий карты
     int ReserveCollisionCapacity = 100;
     GameMapCollisionLayer.reserve(ReserveCollisionCapacity);
-    LadderCollisionLayer.reserve(5); // Резервируем место для коллизий лестниц
 
     // Загружаем карту из файла
     if (!GameMap.load(ASSETS_PATH + "Map/GarikMap.tmx"))
@@ -45,8 +38,8 @@ void AGameMap::InitGameMap()
         throw std::runtime_error("Error: Failed to load texture: " + ASSETS_PATH + "Map/GarikMap.tmx");
     }
 
-    // Загружаем текстуры тайлов
-    LoadTilesets(GameMap);
+    // Загружаем текстуры тайлов и таблицу GID -> тайлсет
+    TileMapRenderer.InitTileMapRenderer(GameMap);
 
     // Проверяем и обрабатываем слои карты
     CheckLayers(GameMap);
@@ -55,33 +48,10 @@ void AGameMap::InitGameMap()
     ProcessCollisionLayers(GameMap);
 }
 
-/**
-* @brief Загрузка тайлсетов.
-* 
-* Загружает текстуры тайлов, используемые на карте.
-* 
-* @param GameMap Объект карты, содержащий информацию о тайлсетах.
-*/
-void AGameMap::LoadTilesets(const tmx::Map& GameMap)
-{
-    const auto& Tilesets = GameMap.getTilesets();
-    for (const auto& Tileset : Tilesets)
-    {
-        sf::Texture Texture;
-        std::string ImagePath = Tileset.getImagePath();
-
-        // Загружаем текстуру тайлов
-        if (Texture.loadFromFile(Tileset.getImagePath()))
-        {
-            TilesetTextures[Tileset.getFirstGID()] = std::move(Texture);
-        }
-    }
-}
-
 /**
 * @brief Проверка слоев карты.
 * 
-* Проходит по всем слоям карты и обрабатывает тайловые слои.
+* Проходит по всем слоям карты и строит чанки отрисовки тайловых слоёв.
 * 
 * @param GameMap Объект карты, содержащий слои.
 */
@@ -93,100 +63,16 @@ void AGameMap::CheckLayers(const tmx::Map& GameMap)
         if (Layer->getType() == tmx::Layer::Type::Tile)
         {
             const auto* TileLayerPtr = dynamic_cast<const tmx::TileLayer*>(Layer.get());
-            // Обрабатываем тайловый слой
-            ProcessTileLayer(TileLayerPtr);
-        }
-    }
-}
+            // Строим чанки тайлового слоя, в них попадают только непустые тайлы
+            TileMapRenderer.BuildTileLayer(*TileLayerPtr);
 
-/**
-* @brief Обработка тайлового слоя.
-* 
-* Создает массивы вершин для каждого тайлового слоя карты, подготавливая их к отрисовке.
-* 
-* @param TileLayerPtr Указатель на объект тайлового слоя.
-*/
-void AGameMap::ProcessTileLayer(const tmx::TileLayer* TileLayerPtr)
-{
-    const auto& Tiles = TileLayerPtr->getTiles();
-    const auto& MapSize = TileLayerPtr->getSize();
-    std::map<const sf::Texture*, sf::VertexArray> LayerVertexMap;
-
-    for (uint32_t y = 0; y < MapSize.y; ++y)
-    {
-        for (uint32_t x = 0; x < MapSize.x; ++x)
-        {
-            tmx::TileLayer::Tile Tile = Tiles[y * MapSize.x + x];
-            if (Tile.ID == 0)
+            // Строим битовую карту твёрдых тайлов по основному слою карты
+            if (TileLayerPtr->getName() == "GameTiles")
             {
-                continue; // Пропускаем пустые тайлы
+                TileCollisionMap.BuildTileCollisionMap(*TileLayerPtr, GameMap.getTilesets(), GameMap.getTileSize());
             }
-
-            const sf::Texture* CurrentTexturePtr = nullptr;
-            uint32_t FirstGID = 0;
-
-            // Определяем, к какому тайлсету принадлежит тайл
-            for (const auto& Pair : TilesetTextures)
-            {
-                if (Tile.ID >= Pair.first)
-                {
-                    CurrentTexturePtr = &Pair.second;
-                    FirstGID = Pair.first;
-                }
-                else
-                {
-                    break;
-                }
-            }
-
-            if (!CurrentTexturePtr)
-            {
-                continue;
-            }
-
-            // Рассчитываем координаты текстуры
-            uint32_t LocalTileID = Tile.ID - FirstGID;
-            uint32_t tilesPerRow = CurrentTexturePtr->getSize().x / 16;
-            uint32_t TextureHorizontal = LocalTileID % tilesPerRow;
-            uint32_t TextureVertical = LocalTileID / tilesPerRow;
-
-            sf::VertexArray& Vertices = LayerVertexMap[CurrentTexturePtr];
-            if (Vertices.getVertexCount() == 0)
-            {
-                Vertices.setPrimitiveType(sf::Quads);
-                Vertices.resize(MapSize.x * MapSize.y * 4);
-            }
-
-            // Задаем позиции вершин для каждого тайла
-            sf::Vertex* Quad = &Vertices[(x + y * MapSize.x) * 4];
-
-            Quad[0].position = sf::Vector2f(x * 16.f, y * 16.f);
-            Quad[1].position = sf::Vector2f((x + 1) * 16.f, y * 16.f);
-            Quad[2].position = sf::Vector2f((x + 1) * 16.f, (y + 1) * 16.f);
-            Quad[3].position = sf::Vector2f(x * 16.f, (y + 1) * 16.f);
-
-            // Задаем текстурные координаты
-            sf::Vector2f texCoords[4] = {
-                sf::Vector2f(TextureHorizontal * 16.f, TextureVertical * 16.f),
-                sf::Vector2f((TextureHorizontal + 1) * 16.f, TextureVertical * 16.f),
-                sf::Vector2f((TextureHorizontal + 1) * 16.f, (TextureVertical + 1) * 16.f),
-                sf::Vector2f(TextureHorizontal * 16.f, (TextureVertical + 1) * 16.f)
-            };
-
-            Quad[0].texCoords = texCoords[0];
-            Quad[1].texCoords = texCoords[1];
-            Quad[2].texCoords = texCoords[2];
-            Quad[3].texCoords = texCoords[3];
         }
     }
-
-    // Сохраняем массивы вершин и состояния отрисовки
-    for (const auto& Pair : LayerVertexMap)
-    {
-        LayersVector.emplace_back(Pair.second);
-        RenderStatesVector.emplace_back();
-        RenderStatesVector.back().texture = Pair.first;
-    }
 }
 
 /**
@@ -198,6 +84,13 @@ void AGameMap::ProcessTileLayer(const tmx::TileLayer* TileLayerPtr)
 */
 void AGameMap::ProcessCollisionLayers(const tmx::Map& GameMap)
 {
+    // Сетка динамических препятствий покрывает всю карту, так как они включаются и выключаются по одному
+    const sf::FloatRect MapBounds(0.f, 0.f,
+                                  static_cast<float>(GameMap.getTileCount().x * GameMap.getTileSize().x),
+                                  static_cast<float>(GameMap.getTileCount().y * GameMap.getTileSize().y));
+    DynamicObstacleLayer.InitDynamicObstacleLayer(MapBounds);
+    TriggerVolumeLayer.InitTriggerVolumeLayer(MapBounds);
+
     for (const auto& Layer : GameMap.getLayers())
     {
         if (Layer->getType() == tmx::Layer::Type::Object)
@@ -214,33 +107,45 @@ void AGameMap::ProcessCollisionLayers(const tmx::Map& GameMap)
             {
                 tmx::FloatRect TmxRect = Object.getAABB();
                 
-                // Добавляем объекты в слой коллизий
+                // Добавляем зону вертолёта и финиша в слой зон-триггеров
                 if (ObjectLayer && ObjectLayer->getName() == "SpawnSoundHelicopter")
                 {
-                    SpawnSoundHelicopterLayer = {TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height};
+                    TriggerVolumeLayer.AddTrigger(ETriggerType::ETT_SoundHelicopter,
+                                                  {TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height});
                 }
                 else if (ObjectLayer && ObjectLayer->getName() == "FinishCollision")
                 {
-                    MissionAccomplishedLayer = {TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height};
+                    TriggerVolumeLayer.AddTrigger(ETriggerType::ETT_MissionAccomplished,
+                                                  {TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height});
                 }
+                // Добавляем объекты в слой коллизий
                 else if (ObjectLayer && ObjectLayer->getName() == "Obstacles")
                 {
                     GameMapCollisionLayer.emplace_back(TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height);
                 }
+                // Добавляем двери и ворота в слой динамических препятствий
+                else if (ObjectLayer && ObjectLayer->getName() == "DynamicObstacles")
+                {
+                    DynamicObstacleLayer.AddObstacle(Object.getName(),
+                                                     {TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height});
+                }
                 // Добавляем объекты в слой повреждающих коллизий лавы
                 else if (ObjectLayer && ObjectLayer->getName() == "LavaDamageCollision")
                 {
-                    LavaDamageCollisionLayer.emplace_back(TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height);
+                    TriggerVolumeLayer.AddTrigger(ETriggerType::ETT_LavaDamage,
+                                                  {TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height});
                 }
                 // Добавляем объекты в слой повреждающих коллизий пик
                 else if (ObjectLayer && ObjectLayer->getName() == "PeaksDamageCollision")
                 {
-                    PeaksDamageCollisionLayer.emplace_back(TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height);
+                    TriggerVolumeLayer.AddTrigger(ETriggerType::ETT_PeaksDamage,
+                                                  {TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height});
                 }
                 // Добавляем объекты в слой коллизий лестниц
                 else if (ObjectLayer && ObjectLayer->getName() == "Ladders")
                 {
-                    LadderCollisionLayer.emplace_back(TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height);
+                    TriggerVolumeLayer.AddTrigger(ETriggerType::ETT_Ladder,
+                                                  {TmxRect.left, TmxRect.top, TmxRect.width, TmxRect.height});
                 }
                 // Устанавливаем позиции спавна врагов
                 else if (ObjectLayer && ObjectLayer->getName() == "SpawnEnemy")
@@ -270,103 +175,192 @@ void AGameMap::ProcessCollisionLayers(const tmx::Map& GameMap)
             }
         }
     }
+
+    // Объединяем соседние препятствия, чтобы проверок было меньше и персонаж не цеплялся за стыки
+    const size_t ObstaclesCountBefore = GameMapCollisionLayer.size();
+    MergeCollisionRects(GameMapCollisionLayer);
+    std::cout << "Obstacles merged: " << ObstaclesCountBefore << " -> " << GameMapCollisionLayer.size() << std::endl;
+
+    // Строим сетку препятствий, чтобы проверки коллизий не перебирали всю карту
+    ObstacleGrid.BuildGrid(GameMapCollisionLayer, COLLISION_GRID_CELL_SIZE);
+
+    // Копия границ препятствий по массивам для пакетной проверки кандидатов из сетки
+    ObstacleRectSoA.BuildRectSoA(GameMapCollisionLayer);
+}
+
+/**
+* @brief Объединение соседних прямоугольников коллизий.
+* 
+* Удаляет вырожденные и вложенные прямоугольники и объединяет прямоугольники с общей стороной
+* (одинаковый диапазон по одной оси и касание или перекрытие по другой), пока объединять больше нечего.
+* 
+* @param Rects Вектор прямоугольников коллизий, который изменяется на месте.
+*/
+void AGameMap::MergeCollisionRects(std::vector<sf::FloatRect>& Rects) const
+{
+    // Допуск на неточность координат объектов, нарисованных в Tiled
+    constexpr float Epsilon = 0.5f;
+
+    // Прямоугольники без площади ни с чем не пересекаются
+    std::erase_if(Rects, [](const sf::FloatRect& Rect)
+    {
+        return Rect.width <= 0.f || Rect.height <= 0.f;
+    });
+
+    bool bMerged = true;
+    while (bMerged)
+    {
+        bMerged = false;
+
+        for (size_t i = 0; i < Rects.size() && !bMerged; ++i)
+        {
+            for (size_t j = 0; j < Rects.size(); ++j)
+            {
+                if (i == j)
+                {
+                    continue;
+                }
+
+                const sf::FloatRect& First = Rects[i];
+                const sf::FloatRect& Second = Rects[j];
+
+                const float FirstRight = First.left + First.width;
+                const float FirstBottom = First.top + First.height;
+                const float SecondRight = Second.left + Second.width;
+                const float SecondBottom = Second.top + Second.height;
+
+                // Второй прямоугольник целиком внутри первого
+                const bool bContained = Second.left >= First.left - Epsilon && Second.top >= First.top - Epsilon &&
+                                        SecondRight <= FirstRight + Epsilon && SecondBottom <= FirstBottom + Epsilon;
+
+                // Одинаковый диапазон по Y, касание или перекрытие по X
+                const bool bSameRow = std::abs(First.top - Second.top) < Epsilon &&
+                                      std::abs(FirstBottom - SecondBottom) < Epsilon &&
+                                      Second.left <= FirstRight + Epsilon && First.left <= SecondRight + Epsilon;
+
+                // Одинаковый диапазон по X, касание или перекрытие по Y
+                const bool bSameColumn = std::abs(First.left - Second.left) < Epsilon &&
+                                         std::abs(FirstRight - SecondRight) < Epsilon &&
+                                         Second.top <= FirstBottom + Epsilon && First.top <= SecondBottom + Epsilon;
+
+                if (!bContained && !bSameRow && !bSameColumn)
+                {
+                    continue;
+                }
+
+                if (!bContained)
+                {
+                    const float Left = std::min(First.left, Second.left);
+                    const float Top = std::min(First.top, Second.top);
+                    Rects[i] = {
+                        Left, Top, std::max(FirstRight, SecondRight) - Left, std::max(FirstBottom, SecondBottom) - Top
+                    };
+                }
+
+                Rects.erase(Rects.begin() + static_cast<std::ptrdiff_t>(j));
+                bMerged = true;
+                break;
+            }
+        }
+    }
 }
 
 /**
-* @brief Сброс состояния карты.
+* @brief Обновление анимированных тайлов карты.
 * 
-* Возвращает карту в её исходное состояние для повторного использования.
+* @param DeltaTime Время, прошедшее с последнего обновления.
 */
-void AGameMap::ResetGameMap()
+void AGameMap::UpdateGameMap(float DeltaTime)
 {
-    SpawnBaseEnemyPosition.clear();
-    SpawnBossEnemyPosition.clear();
-    SpawnChestPosition.clear();
-    SpawnHealingObjectsPosition.clear();
-    GameMapCollisionLayer.clear();
-    LavaDamageCollisionLayer.clear();
-    LadderCollisionLayer.clear();
-    LayersVector.clear();
-    RenderStatesVector.clear();
-    TilesetTextures.clear();
+    TileMapRenderer.UpdateTileAnimations(DeltaTime);
 }
 
 /**
 * @brief Отрисовка игровой карты.
 * 
+* Отрисовываются только чанки карты, которые попадают в текущую камеру окна.
+* 
 * @param Window Окно, в котором будет отображаться карта.
 */
 void AGameMap::DrawGameMap(sf::RenderWindow& Window) const
 {
-    for (size_t i = 0; i < LayersVector.size(); ++i)
-    {
-        Window.draw(LayersVector[i], RenderStatesVector[i]);
-    }
+    TileMapRenderer.DrawTileMap(Window);
 }
 
 /**
-* @brief Коллизия для начала затишья фоновой музыки и активации звука вертолёта.
-* 
-* Эта коллизия срабатывает, когда персонаж приближается к точке эвакуации,
-* вызывая уменьшение громкости фоновой музыки и включение звука вертолёта.
+* @brief Вектор коллизий игровой карты.
 * 
-* @return Прямоугольник, представляющий область коллизии для активации звука вертолёта.
+* @return Вектор прямоугольников коллизий, определяющие препятствия на карте.
 */
-sf::FloatRect AGameMap::GetSpawnSoundHelicopterLayer() const
+const std::vector<sf::FloatRect>& AGameMap::GetGameMapCollisionVector() const
 {
-    return SpawnSoundHelicopterLayer;
+    return GameMapCollisionLayer;
 }
 
 /**
-* @brief Коллизия, которая обозначает завершение игры и начало проигрывания титров.
+* @brief Получение сетки, по которой ищутся препятствия карты.
 * 
-* Когда персонаж попадает в эту область, игра заканчивается и начинается показ титров.
+* @return Сетка с индексами прямоугольников из вектора коллизий карты.
+*/
+const ASpatialGrid& AGameMap::GetObstacleGrid() const
+{
+    return ObstacleGrid;
+}
+
+/**
+* @brief Получение битовой карты твёрдых тайлов слоя GameTiles.
 * 
-* @return Прямоугольник, представляющий область коллизии завершения игры.
+* @return Битовая карта твёрдых тайлов.
 */
-sf::FloatRect AGameMap::GetMissionAccomplishedLayer() const
+const ATileCollisionMap& AGameMap::GetTileCollisionMap() const
 {
-    return MissionAccomplishedLayer;
+    return TileCollisionMap;
 }
 
 /**
-* @brief Вектор коллизий игровой карты.
+* @brief Собирает индексы препятствий, которые пересекают область.
 * 
-* @return Вектор прямоугольников коллизий, определяющие препятствия на карте.
+* Кандидаты из сетки проверяются с областью пачками векторным ядром ARectSoA.
+* Индексы отсортированы по возрастанию, поэтому порядок обхода совпадает с порядком в векторе коллизий.
+* 
+* @param Area Область запроса.
+* @param OutIndices Вектор, в который записываются индексы (предварительно очищается).
 */
-std::vector<sf::FloatRect>& AGameMap::GetGameMapCollisionVector()
+void AGameMap::QueryObstacles(const sf::FloatRect& Area, std::vector<uint32_t>& OutIndices) const
 {
-    return GameMapCollisionLayer;
+    ObstacleGrid.QueryRect(Area, OutIndices);
+    ObstacleRectSoA.FilterIntersecting(Area, OutIndices);
+    std::sort(OutIndices.begin(), OutIndices.end());
 }
 
 /**
-* @brief Получение вектора коллизий участков карты, которые наносят урон.
+* @brief Получение слоя динамических препятствий (двери, ворота), которые можно включать и выключать.
 * 
-* @return Вектор прямоугольников коллизий участков карты, наносящих урон.
+* @return Слой динамических препятствий.
 */
-std::vector<sf::FloatRect> AGameMap::GetLavaDamageCollisionVector() const
+ADynamicObstacleLayer& AGameMap::GetDynamicObstacleLayer()
 {
-    return LavaDamageCollisionLayer;
+    return DynamicObstacleLayer;
 }
 
 /**
-* @brief Получение вектора с коллизиями, наносящими урон.
+* @brief Получение слоя динамических препятствий (двери, ворота), которые можно включать и выключать.
 * 
-* @return Вектор прямоугольников, представляющих области с повреждающими коллизиями.
+* @return Слой динамических препятствий.
 */
-std::vector<sf::FloatRect> AGameMap::GetPeaksDamageCollisionVector() const
+const ADynamicObstacleLayer& AGameMap::GetDynamicObstacleLayer() const
 {
-    return PeaksDamageCollisionLayer;
+    return DynamicObstacleLayer;
 }
 
 /**
- * @brief Получение вектора с коллизиями лестниц.
- * 
- * @return Вектор прямоугольников, представляющих области с коллизиями лестниц.
- */
-std::vector<sf::FloatRect> AGameMap::GetLadderCollisionVector() const
+* @brief Получение слоя зон-триггеров (лава, пики, лестницы, зона вертолёта и финиш).
+* 
+* @return Слой зон-триггеров.
+*/
+const ATriggerVolumeLayer& AGameMap::GetTriggerVolumeLayer() const
 {
-    return LadderCollisionLayer;
+    return TriggerVolumeLayer;
 }
 
 /**
@@ -5,6 +5,12 @@
 #include <tmxlite/TileLayer.hpp>
 #include "../Constants.h"
 #include "../Player/Player.h"
+#include "SpatialGrid.h"
+#include "RectSoA.h"
+#include "TileCollisionMap.h"
+#include "DynamicObstacleLayer.h"
+#include "TriggerVolumeLayer.h"
+#include "TileMapRenderer.h"
 
 /**
  * @brief Класс, представляющий игровую карту.
@@ -35,103 +41,102 @@ public:
     void InitGameMap();
 
 private:
-    /**
-     * @brief Загрузка тайлсетов.
-     * 
-     * Загружает текстуры тайлов, используемые на карте.
-     * 
-     * @param GameMap Объект карты, содержащий информацию о тайлсетах.
-     */
-    void LoadTilesets(const tmx::Map& GameMap);
-
     /**
      * @brief Проверка слоев карты.
      * 
-     * Проходит по всем слоям карты и обрабатывает тайловые слои.
+     * Проходит по всем слоям карты и строит чанки отрисовки тайловых слоёв.
      * 
      * @param GameMap Объект карты, содержащий слои.
      */
     void CheckLayers(const tmx::Map& GameMap);
 
     /**
-     * @brief Обработка тайлового слоя.
+     * @brief Обработка слоев коллизий.
      * 
-     * Создает массивы вершин для каждого тайлового слоя карты, подготавливая их к отрисовке.
+     * Определяет слои, отвечающие за коллизии, лестницы и спавн объектов, и сохраняет соответствующие данные.
      * 
-     * @param TileLayerPtr Указатель на объект тайлового слоя.
+     * @param GameMap Объект карты, содержащий слои с информацией о коллизиях.
      */
-    void ProcessTileLayer(const tmx::TileLayer* TileLayerPtr);
+    void ProcessCollisionLayers(const tmx::Map& GameMap);
 
     /**
-     * @brief Обработка слоев коллизий.
+     * @brief Объединение соседних прямоугольников коллизий.
      * 
-     * Определяет слои, отвечающие за коллизии, лестницы и спавн объектов, и сохраняет соответствующие данные.
+     * Удаляет вырожденные и вложенные прямоугольники и объединяет прямоугольники с общей стороной
+     * (одинаковый диапазон по одной оси и касание или перекрытие по другой), пока объединять больше нечего.
      * 
-     * @param GameMap Объект карты, содержащий слои с информацией о коллизиях.
+     * @param Rects Вектор прямоугольников коллизий, который изменяется на месте.
      */
-    void ProcessCollisionLayers(const tmx::Map& GameMap);
+    void MergeCollisionRects(std::vector<sf::FloatRect>& Rects) const;
 
 public:
     /**
-    * @brief Сброс состояния карты.
+    * @brief Обновление анимированных тайлов карты.
     * 
-    * Возвращает карту в её исходное состояние для повторного использования.
+    * @param DeltaTime Время, прошедшее с последнего обновления.
     */
-    void ResetGameMap();
+    void UpdateGameMap(float DeltaTime);
 
     /**
     * @brief Отрисовка игровой карты.
     * 
+    * Отрисовываются только чанки карты, которые попадают в текущую камеру окна.
+    * 
     * @param Window Окно, в котором будет отображаться карта.
     */
     void DrawGameMap(sf::RenderWindow& Window) const;
 
-   /**
-    * @brief Коллизия для начала затишья фоновой музыки и активации звука вертолёта.
-    * 
-    * Эта коллизия срабатывает, когда персонаж приближается к точке эвакуации,
-    * вызывая уменьшение громкости фоновой музыки и включение звука вертолёта.
-    * 
-    * @return Прямоугольник, представляющий область коллизии для активации звука вертолёта.
-    */
-    sf::FloatRect GetSpawnSoundHelicopterLayer() const;
+    /**
+     * @brief Вектор коллизий игровой карты.
+     * 
+     * @return Вектор прямоугольников коллизий, определяющие препятствия на карте.
+     */
+    const std::vector<sf::FloatRect>& GetGameMapCollisionVector() const;
 
     /**
-     * @brief Коллизия, которая обозначает завершение игры и начало проигрывания титров.
+     * @brief Получение сетки, по которой ищутся препятствия карты.
      * 
-     * Когда персонаж попадает в эту область, игра заканчивается и начинается показ титров.
+     * @return Сетка с индексами прямоугольников из вектора коллизий карты.
+     */
+    const ASpatialGrid& GetObstacleGrid() const;
+
+    /**
+     * @brief Получение битовой карты твёрдых тайлов слоя GameTiles.
      * 
-     * @return Прямоугольник, представляющий область коллизии завершения игры.
+     * @return Битовая карта твёрдых тайлов.
      */
-    sf::FloatRect GetMissionAccomplishedLayer() const;
+    const ATileCollisionMap& GetTileCollisionMap() const;
 
     /**
-     * @brief Вектор коллизий игровой карты.
+     * @brief Собирает индексы препятствий, которые пересекают область.
      * 
-     * @return Вектор прямоугольников коллизий, определяющие препятствия на карте.
+     * Индексы отсортированы по возрастанию, поэтому порядок обхода совпадает с порядком в векторе коллизий.
+     * 
+     * @param Area Область запроса.
+     * @param OutIndices Вектор, в который записываются индексы (предварительно очищается).
      */
-    std::vector<sf::FloatRect>& GetGameMapCollisionVector();
+    void QueryObstacles(const sf::FloatRect& Area, std::vector<uint32_t>& OutIndices) const;
 
     /**
-     * @brief Получение вектора коллизий участков карты, которые наносят урон.
+     * @brief Получение слоя динамических препятствий (двери, ворота), которые можно включать и выключать.
      * 
-     * @return Вектор прямоугольников коллизий участков карты, наносящих урон.
+     * @return Слой динамических препятствий.
      */
-    std::vector<sf::FloatRect> GetLavaDamageCollisionVector() const;
+    ADynamicObstacleLayer& GetDynamicObstacleLayer();
 
     /**
-    * @brief Получение вектора с коллизиями, наносящими урон.
-    * 
-    * @return Вектор прямоугольников, представляющих области с повреждающими коллизиями.
-    */
-    std::vector<sf::FloatRect> GetPeaksDamageCollisionVector() const;
+     * @brief Получение слоя динамических препятствий (двери, ворота), которые можно включать и выключать.
+     * 
+     * @return Слой динамических препятствий.
+     */
+    const ADynamicObstacleLayer& GetDynamicObstacleLayer() const;
 
-   /**
-    * @brief Получение вектора с коллизиями лестниц.
-    * 
-    * @return Вектор прямоугольников, представляющих области с коллизиями лестниц.
-    */
-    std::vector<sf::FloatRect> GetLadderCollisionVector() const;
+    /**
+     * @brief Получение слоя зон-триггеров (лава, пики, лестницы, зона вертолёта и финиш).
+     * 
+     * @return Слой зон-триггеров.
+     */
+    const ATriggerVolumeLayer& GetTriggerVolumeLayer() const;
 
     /**
      * @brief Вектор позиций базовых врагов.
@@ -163,21 +168,18 @@ public:
 
 private:
     tmx::Map GameMap;                                        // Игровая карта, загруженная из файла
-            
-    sf::FloatRect SpawnSoundHelicopterLayer;                 // Коллизи, чтобы воспроизвести звук вертолёта,
-                                                             // когда будет подходить к точке эвакуации
-    sf::FloatRect MissionAccomplishedLayer;                  // Коллизи, где будет проиходит эвакуация персонажа и конец игры
+
     std::vector<sf::FloatRect> GameMapCollisionLayer;        // Вектор коллизий участков карты, через которые персонаж, враги и пули не могу пройти
-    std::vector<sf::FloatRect> LavaDamageCollisionLayer;     // Вектор коллизий лавы, которые наносят урон
-    std::vector<sf::FloatRect> PeaksDamageCollisionLayer;    // Вектор коллизий пик, которые наносят урон
-    std::vector<sf::FloatRect> LadderCollisionLayer;         // Вектор коллизий лестниц
+    ASpatialGrid ObstacleGrid;                               // Сетка для быстрого поиска препятствий из GameMapCollisionLayer
+    ARectSoA ObstacleRectSoA;                                // Границы препятствий по массивам для пакетной проверки
+    ATileCollisionMap TileCollisionMap;                      // Битовая карта твёрдых тайлов слоя GameTiles
+    ADynamicObstacleLayer DynamicObstacleLayer;              // Динамические препятствия (ворота), которые можно выключать
+    ATriggerVolumeLayer TriggerVolumeLayer;                  // Зоны-триггеры: лава, пики, лестницы, зона вертолёта и финиш
 
     std::vector<sf::Vector2f> SpawnBaseEnemyPosition;        // Вектор, который хранит позиции для спавна обычных врагов на карте.
     std::vector<sf::Vector2f> SpawnBossEnemyPosition;        // Вектор, который хранит позиции для спавна босса врагов на карте.
     std::vector<sf::Vector2f> SpawnChestPosition;            // Вектор, который хранит позиции для спавна сундуков на карте.
     std::vector<sf::Vector2f> SpawnHealingObjectsPosition;   // Вектор, который хранит позиции для спавна лечения на карте.
 
-    std::vector<sf::VertexArray> LayersVector;               // Вектор массивов вершин для каждого слоя карты
-    std::vector<sf::RenderStates> RenderStatesVector;        // Вектор состояний отрисовки для каждого слоя карты
-    std::map<uint32_t, sf::Texture> TilesetTextures;         // Карта, связывающая идентификаторы тайлов с их текстурами.
+    ATileMapRenderer TileMapRenderer;                        // Чанки тайловых слоёв и текстуры тайлсетов для отрисовки
 };
@@ -0,0 +1,200 @@
+﻿#include "RectSoA.h"
+#include <algorithm>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define RECT_SOA_USE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define RECT_SOA_USE_SSE2 1
+#endif
+
+/**
+ * @brief Заполняет хранилище прямоугольниками, индексы совпадают с индексами во входном векторе.
+ *
+ * @param Rects Вектор прямоугольников.
+ */
+void ARectSoA::BuildRectSoA(const std::vector<sf::FloatRect>& Rects)
+{
+    ClearRectSoA();
+
+    Lefts.reserve(Rects.size());
+    Tops.reserve(Rects.size());
+    Rights.reserve(Rects.size());
+    Bottoms.reserve(Rects.size());
+
+    for (const sf::FloatRect& Rect : Rects)
+    {
+        AddRect(Rect);
+    }
+}
+
+/**
+ * @brief Добавляет прямоугольник в конец хранилища.
+ *
+ * @param Rect Прямоугольник.
+ */
+void ARectSoA::AddRect(const sf::FloatRect& Rect)
+{
+    // Как и sf::FloatRect::intersects, учитываем прямоугольники с отрицательной шириной или высотой
+    Lefts.emplace_back(std::min(Rect.left, Rect.left + Rect.width));
+    Tops.emplace_back(std::min(Rect.top, Rect.top + Rect.height));
+    Rights.emplace_back(std::max(Rect.left, Rect.left + Rect.width));
+    Bottoms.emplace_back(std::max(Rect.top, Rect.top + Rect.height));
+}
+
+/**
+ * @brief Очищает хранилище.
+ */
+void ARectSoA::ClearRectSoA()
+{
+    Lefts.clear();
+    Tops.clear();
+    Rights.clear();
+    Bottoms.clear();
+}
+
+/**
+ * @brief Проверяет область с пачкой прямоугольников по их индексам.
+ *
+ * @param Query Область запроса.
+ * @param Indices Индексы прямоугольников.
+ * @param Count Количество индексов (не больше RECT_BATCH_SIZE).
+ *
+ * @return Маска попаданий: бит i установлен, если прямоугольник Indices[i] пересекает область.
+ */
+uint32_t ARectSoA::IntersectMask(const sf::FloatRect& Query, const uint32_t* Indices, size_t Count) const
+{
+    if (Count == 0)
+    {
+        return 0;
+    }
+
+#if defined(RECT_SOA_USE_AVX2) || defined(RECT_SOA_USE_SSE2)
+    const float QueryLeft = std::min(Query.left, Query.left + Query.width);
+    const float QueryTop = std::min(Query.top, Query.top + Query.height);
+    const float QueryRight = std::max(Query.left, Query.left + Query.width);
+    const float QueryBottom = std::max(Query.top, Query.top + Query.height);
+
+    // Неполную пачку дополняем первым индексом, лишние биты маски затем отбрасываются
+    alignas(32) int32_t BatchIndices[RECT_BATCH_SIZE];
+    for (size_t i = 0; i < RECT_BATCH_SIZE; ++i)
+    {
+        BatchIndices[i] = static_cast<int32_t>(Indices[i < Count ? i : 0]);
+    }
+
+    const uint32_t ValidMask = (1u << Count) - 1u;
+#endif
+
+#if defined(RECT_SOA_USE_AVX2)
+    const __m256i Index = _mm256_load_si256(reinterpret_cast<const __m256i*>(BatchIndices));
+
+    const __m256 Left = _mm256_i32gather_ps(Lefts.data(), Index, sizeof(float));
+    const __m256 Top = _mm256_i32gather_ps(Tops.data(), Index, sizeof(float));
+    const __m256 Right = _mm256_i32gather_ps(Rights.data(), Index, sizeof(float));
+    const __m256 Bottom = _mm256_i32gather_ps(Bottoms.data(), Index, sizeof(float));
+
+    // Пересечение есть, если область пересечения по обеим осям имеет положительный размер
+    const __m256 InterLeft = _mm256_max_ps(Left, _mm256_set1_ps(QueryLeft));
+    const __m256 InterRight = _mm256_min_ps(Right, _mm256_set1_ps(QueryRight));
+    const __m256 InterTop = _mm256_max_ps(Top, _mm256_set1_ps(QueryTop));
+    const __m256 InterBottom = _mm256_min_ps(Bottom, _mm256_set1_ps(QueryBottom));
+
+    const __m256 Hit = _mm256_and_ps(_mm256_cmp_ps(InterLeft, InterRight, _CMP_LT_OQ),
+                                     _mm256_cmp_ps(InterTop, InterBottom, _CMP_LT_OQ));
+
+    return static_cast<uint32_t>(_mm256_movemask_ps(Hit)) & ValidMask;
+#elif defined(RECT_SOA_USE_SSE2)
+    const __m128 QueryLeftVec = _mm_set1_ps(QueryLeft);
+    const __m128 QueryTopVec = _mm_set1_ps(QueryTop);
+    const __m128 QueryRightVec = _mm_set1_ps(QueryRight);
+    const __m128 QueryBottomVec = _mm_set1_ps(QueryBottom);
+
+    uint32_t Mask = 0;
+
+    // SSE2 не умеет собирать значения по индексам, поэтому проверяем две четвёрки
+    for (size_t Half = 0; Half < RECT_BATCH_SIZE; Half += 4)
+    {
+        const int32_t* I = BatchIndices + Half;
+
+        const __m128 Left = _mm_setr_ps(Lefts[I[0]], Lefts[I[1]], Lefts[I[2]], Lefts[I[3]]);
+        const __m128 Top = _mm_setr_ps(Tops[I[0]], Tops[I[1]], Tops[I[2]], Tops[I[3]]);
+        const __m128 Right = _mm_setr_ps(Rights[I[0]], Rights[I[1]], Rights[I[2]], Rights[I[3]]);
+        const __m128 Bottom = _mm_setr_ps(Bottoms[I[0]], Bottoms[I[1]], Bottoms[I[2]], Bottoms[I[3]]);
+
+        const __m128 Hit = _mm_and_ps(_mm_cmplt_ps(_mm_max_ps(Left, QueryLeftVec), _mm_min_ps(Right, QueryRightVec)),
+                                      _mm_cmplt_ps(_mm_max_ps(Top, QueryTopVec), _mm_min_ps(Bottom, QueryBottomVec)));
+
+        Mask |= static_cast<uint32_t>(_mm_movemask_ps(Hit)) << Half;
+
+        if (Half + 4 >= Count)
+        {
+            break;
+        }
+    }
+
+    return Mask & ValidMask;
+#else
+    return IntersectMaskScalar(Query, Indices, Count);
+#endif
+}
+
+/**
+ * @brief Оставляет в векторе только индексы прямоугольников, которые пересекают область.
+ *
+ * @param Query Область запроса.
+ * @param InOutIndices Индексы кандидатов, порядок оставшихся индексов сохраняется.
+ */
+void ARectSoA::FilterIntersecting(const sf::FloatRect& Query, std::vector<uint32_t>& InOutIndices) const
+{
+    size_t WriteIndex = 0;
+
+    for (size_t ReadIndex = 0; ReadIndex < InOutIndices.size(); ReadIndex += RECT_BATCH_SIZE)
+    {
+        const size_t Count = std::min(RECT_BATCH_SIZE, InOutIndices.size() - ReadIndex);
+        uint32_t Mask = IntersectMask(Query, InOutIndices.data() + ReadIndex, Count);
+
+        // Сдвигаем попавшие индексы к началу вектора, запись никогда не обгоняет чтение
+        for (size_t i = 0; i < Count; ++i, Mask >>= 1)
+        {
+            if (Mask & 1u)
+            {
+                InOutIndices[WriteIndex++] = InOutIndices[ReadIndex + i];
+            }
+        }
+    }
+
+    InOutIndices.resize(WriteIndex);
+}
+
+/**
+ * @brief Скалярная проверка пачки прямоугольников, используется без векторных инструкций.
+ *
+ * @param Query Область запроса.
+ * @param Indices Индексы прямоугольников.
+ * @param Count Количество индексов (не больше RECT_BATCH_SIZE).
+ *
+ * @return Маска попаданий.
+ */
+uint32_t ARectSoA::IntersectMaskScalar(const sf::FloatRect& Query, const uint32_t* Indices, size_t Count) const
+{
+    const float QueryLeft = std::min(Query.left, Query.left + Query.width);
+    const float QueryTop = std::min(Query.top, Query.top + Query.height);
+    const float QueryRight = std::max(Query.left, Query.left + Query.width);
+    const float QueryBottom = std::max(Query.top, Query.top + Query.height);
+
+    uint32_t Mask = 0;
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const uint32_t Index = Indices[i];
+
+        if (std::max(Lefts[Index], QueryLeft) < std::min(Rights[Index], QueryRight) &&
+            std::max(Tops[Index], QueryTop) < std::min(Bottoms[Index], QueryBottom))
+        {
+            Mask |= 1u << i;
+        }
+    }
+
+    return Mask;
+}
@@ -0,0 +1,83 @@
+﻿#pragma once
+#include "../Constants.h"
+
+/**
+ * @brief Хранилище прямоугольников в виде структуры массивов (левые, верхние, правые и нижние границы).
+ *
+ * Границы каждой оси лежат в отдельном массиве, поэтому один запрос проверяется сразу с пачкой прямоугольников
+ * векторными инструкциями: AVX2 (8 прямоугольников за инструкцию), SSE2 (по 4) или скалярным циклом,
+ * если векторные инструкции недоступны. Результат проверки совпадает с sf::FloatRect::intersects.
+ */
+class ARectSoA
+{
+public:
+    /**
+     * @brief Количество прямоугольников, которое проверяется за один вызов ядра.
+     */
+    static constexpr size_t RECT_BATCH_SIZE = 8;
+
+    /**
+     * @brief Конструктор класса ARectSoA.
+     */
+    ARectSoA() = default;
+
+    /**
+     * @brief Деструктор класса ARectSoA.
+     */
+    ~ARectSoA() = default;
+
+    /**
+     * @brief Заполняет хранилище прямоугольниками, индексы совпадают с индексами во входном векторе.
+     *
+     * @param Rects Вектор прямоугольников.
+     */
+    void BuildRectSoA(const std::vector<sf::FloatRect>& Rects);
+
+    /**
+     * @brief Добавляет прямоугольник в конец хранилища.
+     *
+     * @param Rect Прямоугольник.
+     */
+    void AddRect(const sf::FloatRect& Rect);
+
+    /**
+     * @brief Очищает хранилище.
+     */
+    void ClearRectSoA();
+
+    /**
+     * @brief Проверяет область с пачкой прямоугольников по их индексам.
+     *
+     * @param Query Область запроса.
+     * @param Indices Индексы прямоугольников.
+     * @param Count Количество индексов (не больше RECT_BATCH_SIZE).
+     *
+     * @return Маска попаданий: бит i установлен, если прямоугольник Indices[i] пересекает область.
+     */
+    uint32_t IntersectMask(const sf::FloatRect& Query, const uint32_t* Indices, size_t Count) const;
+
+    /**
+     * @brief Оставляет в векторе только индексы прямоугольников, которые пересекают область.
+     *
+     * @param Query Область запроса.
+     * @param InOutIndices Индексы кандидатов, порядок оставшихся индексов сохраняется.
+     */
+    void FilterIntersecting(const sf::FloatRect& Query, std::vector<uint32_t>& InOutIndices) const;
+
+private:
+    /**
+     * @brief Скалярная проверка пачки прямоугольников, используется без векторных инструкций.
+     *
+     * @param Query Область запроса.
+     * @param Indices Индексы прямоугольников.
+     * @param Count Количество индексов (не больше RECT_BATCH_SIZE).
+     *
+     * @return Маска попаданий.
+     */
+    uint32_t IntersectMaskScalar(const sf::FloatRect& Query, const uint32_t* Indices, size_t Count) const;
+
+    std::vector<float> Lefts;      // Левые границы прямоугольников
+    std::vector<float> Tops;       // Верхние границы прямоугольников
+    std::vector<float> Rights;     // Правые границы прямоугольников
+    std::vector<float> Bottoms;    // Нижние границы прямоугольников
+};
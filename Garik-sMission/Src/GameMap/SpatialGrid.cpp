@@ -0,0 +1,256 @@
+﻿#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Конструктор класса ASpatialGrid.
+ */
+ASpatialGrid::ASpatialGrid()
+    : CellSize(1.f),
+      GridOrigin(0.f, 0.f),
+      GridSize(0, 0),
+      CurrentQueryStamp(0)
+{
+}
+
+/**
+ * @brief Создаёт пустую сетку, покрывающую заданную область.
+ *
+ * @param Bounds Область мира, которую покрывает сетка.
+ * @param NewCellSize Размер стороны ячейки в пикселях.
+ */
+void ASpatialGrid::InitGrid(const sf::FloatRect& Bounds, float NewCellSize)
+{
+    CellSize = NewCellSize;
+    GridOrigin = {Bounds.left, Bounds.top};
+
+    // Хотя бы одна ячейка по каждой оси, даже если область вырождена
+    GridSize.x = std::max(1, static_cast<int>(std::ceil(Bounds.width / CellSize)));
+    GridSize.y = std::max(1, static_cast<int>(std::ceil(Bounds.height / CellSize)));
+
+    Cells.clear();
+    Cells.resize(static_cast<size_t>(GridSize.x) * GridSize.y);
+
+    QueryStamps.clear();
+    CurrentQueryStamp = 0;
+}
+
+/**
+ * @brief Строит сетку по вектору прямоугольников.
+ *
+ * @param Rects Вектор прямоугольников коллизий.
+ * @param NewCellSize Размер стороны ячейки в пикселях.
+ */
+void ASpatialGrid::BuildGrid(const std::vector<sf::FloatRect>& Rects, float NewCellSize)
+{
+    if (Rects.empty())
+    {
+        ClearGrid();
+        return;
+    }
+
+    // Рассчитываем границы сетки по всем прямоугольникам
+    float MinX = Rects.front().left;
+    float MinY = Rects.front().top;
+    float MaxX = Rects.front().left + Rects.front().width;
+    float MaxY = Rects.front().top + Rects.front().height;
+
+    for (const sf::FloatRect& Rect : Rects)
+    {
+        MinX = std::min(MinX, Rect.left);
+        MinY = std::min(MinY, Rect.top);
+        MaxX = std::max(MaxX, Rect.left + Rect.width);
+        MaxY = std::max(MaxY, Rect.top + Rect.height);
+    }
+
+    InitGrid(sf::FloatRect(MinX, MinY, MaxX - MinX, MaxY - MinY), NewCellSize);
+
+    QueryStamps.resize(Rects.size(), 0);
+
+    for (size_t i = 0; i < Rects.size(); ++i)
+    {
+        InsertRect(static_cast<uint32_t>(i), Rects[i]);
+    }
+}
+
+/**
+ * @brief Добавляет прямоугольник во все ячейки, которые он пересекает.
+ *
+ * @param RectIndex Индекс прямоугольника во внешнем хранилище.
+ * @param Rect Прямоугольник коллизии.
+ */
+void ASpatialGrid::InsertRect(uint32_t RectIndex, const sf::FloatRect& Rect)
+{
+    if (Cells.empty())
+    {
+        return;
+    }
+
+    if (RectIndex >= QueryStamps.size())
+    {
+        QueryStamps.resize(RectIndex + 1, 0);
+    }
+
+    sf::Vector2i MinCell;
+    sf::Vector2i MaxCell;
+    GetCellRange(Rect, MinCell, MaxCell);
+
+    for (int y = MinCell.y; y <= MaxCell.y; ++y)
+    {
+        for (int x = MinCell.x; x <= MaxCell.x; ++x)
+        {
+            Cells[static_cast<size_t>(y) * GridSize.x + x].emplace_back(RectIndex);
+        }
+    }
+}
+
+/**
+ * @brief Удаляет прямоугольник из всех ячеек, которые он пересекает.
+ *
+ * @param RectIndex Индекс прямоугольника во внешнем хранилище.
+ * @param Rect Прямоугольник коллизии, с которым он был добавлен.
+ */
+void ASpatialGrid::RemoveRect(uint32_t RectIndex, const sf::FloatRect& Rect)
+{
+    if (Cells.empty())
+    {
+        return;
+    }
+
+    sf::Vector2i MinCell;
+    sf::Vector2i MaxCell;
+    GetCellRange(Rect, MinCell, MaxCell);
+
+    for (int y = MinCell.y; y <= MaxCell.y; ++y)
+    {
+        for (int x = MinCell.x; x <= MaxCell.x; ++x)
+        {
+            std::erase(Cells[static_cast<size_t>(y) * GridSize.x + x], RectIndex);
+        }
+    }
+}
+
+/**
+ * @brief Очищает сетку.
+ */
+void ASpatialGrid::ClearGrid()
+{
+    Cells.clear();
+    QueryStamps.clear();
+    GridSize = {0, 0};
+    CurrentQueryStamp = 0;
+}
+
+/**
+ * @brief Собирает индексы прямоугольников из ячеек, покрытых областью.
+ *
+ * @param Area Область запроса.
+ * @param OutIndices Вектор, в который записываются найденные индексы (предварительно очищается).
+ */
+void ASpatialGrid::QueryRect(const sf::FloatRect& Area, std::vector<uint32_t>& OutIndices) const
+{
+    OutIndices.clear();
+
+    if (Cells.empty())
+    {
+        return;
+    }
+
+    // При переполнении метки сбрасываем все сохранённые метки
+    if (++CurrentQueryStamp == 0)
+    {
+        std::fill(QueryStamps.begin(), QueryStamps.end(), 0);
+        CurrentQueryStamp = 1;
+    }
+
+    sf::Vector2i MinCell;
+    sf::Vector2i MaxCell;
+    GetCellRange(Area, MinCell, MaxCell);
+
+    for (int y = MinCell.y; y <= MaxCell.y; ++y)
+    {
+        for (int x = MinCell.x; x <= MaxCell.x; ++x)
+        {
+            for (uint32_t RectIndex : Cells[static_cast<size_t>(y) * GridSize.x + x])
+            {
+                // Прямоугольник может лежать в нескольких ячейках, добавляем его только один раз
+                if (QueryStamps[RectIndex] != CurrentQueryStamp)
+                {
+                    QueryStamps[RectIndex] = CurrentQueryStamp;
+                    OutIndices.emplace_back(RectIndex);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Получает диапазон ячеек, покрытых областью (ограниченный размерами сетки).
+ *
+ * @param Area Область запроса.
+ * @param OutMinCell Координаты первой ячейки.
+ * @param OutMaxCell Координаты последней ячейки (включительно).
+ */
+void ASpatialGrid::GetCellRange(const sf::FloatRect& Area, sf::Vector2i& OutMinCell, sf::Vector2i& OutMaxCell) const
+{
+    // Объекты за пределами сетки попадают в крайние ячейки, поэтому запрос и вставка остаются согласованными
+    OutMinCell.x = std::clamp(static_cast<int>(std::floor((Area.left - GridOrigin.x) / CellSize)), 0, GridSize.x - 1);
+    OutMinCell.y = std::clamp(static_cast<int>(std::floor((Area.top - GridOrigin.y) / CellSize)), 0, GridSize.y - 1);
+    OutMaxCell.x = std::clamp(static_cast<int>(std::floor((Area.left + Area.width - GridOrigin.x) / CellSize)),
+                              0, GridSize.x - 1);
+    OutMaxCell.y = std::clamp(static_cast<int>(std::floor((Area.top + Area.height - GridOrigin.y) / CellSize)),
+                              0, GridSize.y - 1);
+}
+
+/**
+ * @brief Получает индексы прямоугольников в ячейке.
+ *
+ * @param CellX Координата ячейки по X.
+ * @param CellY Координата ячейки по Y.
+ *
+ * @return Вектор индексов прямоугольников, пересекающих ячейку.
+ */
+const std::vector<uint32_t>& ASpatialGrid::GetCellItems(int CellX, int CellY) const
+{
+    return Cells[static_cast<size_t>(CellY) * GridSize.x + CellX];
+}
+
+/**
+ * @brief Получает размер стороны ячейки.
+ *
+ * @return Размер ячейки в пикселях.
+ */
+float ASpatialGrid::GetCellSize() const
+{
+    return CellSize;
+}
+
+/**
+ * @brief Получает левый верхний угол сетки.
+ *
+ * @return Координаты начала сетки в мире.
+ */
+const sf::Vector2f& ASpatialGrid::GetGridOrigin() const
+{
+    return GridOrigin;
+}
+
+/**
+ * @brief Получает количество ячеек сетки.
+ *
+ * @return Количество ячеек по X и Y.
+ */
+const sf::Vector2i& ASpatialGrid::GetGridSize() const
+{
+    return GridSize;
+}
+
+/**
+ * @brief Проверяет, построена ли сетка.
+ *
+ * @return true, если в сетке есть хотя бы одна ячейка, иначе false.
+ */
+bool ASpatialGrid::IsGridEmpty() const
+{
+    return Cells.empty();
+}
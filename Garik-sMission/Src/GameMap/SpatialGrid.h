@@ -0,0 +1,129 @@
+﻿#pragma once
+#include "../Constants.h"
+
+/**
+ * @brief Равномерная сетка для быстрого поиска прямоугольников коллизий.
+ *
+ * Пространство карты делится на квадратные ячейки, каждая ячейка хранит индексы прямоугольников,
+ * которые её пересекают. Запрос по области проверяет только покрытые ею ячейки,
+ * поэтому его стоимость зависит от плотности объектов рядом, а не от размера карты.
+ */
+class ASpatialGrid
+{
+public:
+    /**
+     * @brief Конструктор класса ASpatialGrid.
+     */
+    ASpatialGrid();
+
+    /**
+     * @brief Деструктор класса ASpatialGrid.
+     */
+    ~ASpatialGrid() = default;
+
+    /**
+     * @brief Создаёт пустую сетку, покрывающую заданную область.
+     *
+     * @param Bounds Область мира, которую покрывает сетка.
+     * @param NewCellSize Размер стороны ячейки в пикселях.
+     */
+    void InitGrid(const sf::FloatRect& Bounds, float NewCellSize);
+
+    /**
+     * @brief Строит сетку по вектору прямоугольников.
+     *
+     * Границы сетки рассчитываются по всем прямоугольникам, индекс в сетке совпадает с индексом в векторе.
+     *
+     * @param Rects Вектор прямоугольников коллизий.
+     * @param NewCellSize Размер стороны ячейки в пикселях.
+     */
+    void BuildGrid(const std::vector<sf::FloatRect>& Rects, float NewCellSize);
+
+    /**
+     * @brief Добавляет прямоугольник во все ячейки, которые он пересекает.
+     *
+     * @param RectIndex Индекс прямоугольника во внешнем хранилище.
+     * @param Rect Прямоугольник коллизии.
+     */
+    void InsertRect(uint32_t RectIndex, const sf::FloatRect& Rect);
+
+    /**
+     * @brief Удаляет прямоугольник из всех ячеек, которые он пересекает.
+     *
+     * @param RectIndex Индекс прямоугольника во внешнем хранилище.
+     * @param Rect Прямоугольник коллизии, с которым он был добавлен.
+     */
+    void RemoveRect(uint32_t RectIndex, const sf::FloatRect& Rect);
+
+    /**
+     * @brief Очищает сетку.
+     */
+    void ClearGrid();
+
+    /**
+     * @brief Собирает индексы прямоугольников из ячеек, покрытых областью.
+     *
+     * Каждый индекс попадает в результат один раз. Точную проверку пересечения выполняет вызывающий код.
+     *
+     * @param Area Область запроса.
+     * @param OutIndices Вектор, в который записываются найденные индексы (предварительно очищается).
+     */
+    void QueryRect(const sf::FloatRect& Area, std::vector<uint32_t>& OutIndices) const;
+
+    /**
+     * @brief Получает диапазон ячеек, покрытых областью (ограниченный размерами сетки).
+     *
+     * @param Area Область запроса.
+     * @param OutMinCell Координаты первой ячейки.
+     * @param OutMaxCell Координаты последней ячейки (включительно).
+     */
+    void GetCellRange(const sf::FloatRect& Area, sf::Vector2i& OutMinCell, sf::Vector2i& OutMaxCell) const;
+
+    /**
+     * @brief Получает индексы прямоугольников в ячейке.
+     *
+     * @param CellX Координата ячейки по X.
+     * @param CellY Координата ячейки по Y.
+     *
+     * @return Вектор индексов прямоугольников, пересекающих ячейку.
+     */
+    const std::vector<uint32_t>& GetCellItems(int CellX, int CellY) const;
+
+    /**
+     * @brief Получает размер стороны ячейки.
+     *
+     * @return Размер ячейки в пикселях.
+     */
+    float GetCellSize() const;
+
+    /**
+     * @brief Получает левый верхний угол сетки.
+     *
+     * @return Координаты начала сетки в мире.
+     */
+    const sf::Vector2f& GetGridOrigin() const;
+
+    /**
+     * @brief Получает количество ячеек сетки.
+     *
+     * @return Количество ячеек по X и Y.
+     */
+    const sf::Vector2i& GetGridSize() const;
+
+    /**
+     * @brief Проверяет, построена ли сетка.
+     *
+     * @return true, если в сетке есть хотя бы одна ячейка, иначе false.
+     */
+    bool IsGridEmpty() const;
+
+private:
+    float CellSize;                                 // Размер стороны ячейки в пикселях
+    sf::Vector2f GridOrigin;                        // Левый верхний угол сетки в координатах мира
+    sf::Vector2i GridSize;                          // Количество ячеек по X и Y
+
+    std::vector<std::vector<uint32_t>> Cells;       // Индексы прямоугольников для каждой ячейки
+
+    mutable std::vector<uint32_t> QueryStamps;      // Метка последнего запроса для каждого индекса, чтобы не дублировать результат
+    mutable uint32_t CurrentQueryStamp;             // Метка текущего запроса
+};
@@ -0,0 +1,423 @@
+﻿#include "TileCollisionMap.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief Конструктор класса ATileCollisionMap.
+ */
+ATileCollisionMap::ATileCollisionMap()
+    : MapSize(0, 0),
+      TileSize(16.f, 16.f),
+      WordsPerRow(0),
+      SolidTileCount(0)
+{
+}
+
+/**
+ * @brief Строит битовую карту по тайловому слою.
+ *
+ * @param TileLayer Тайловый слой, по которому строится карта.
+ * @param Tilesets Тайлсеты карты со свойствами тайлов.
+ * @param NewTileSize Размер тайла в пикселях.
+ */
+void ATileCollisionMap::BuildTileCollisionMap(const tmx::TileLayer& TileLayer,
+                                              const std::vector<tmx::Tileset>& Tilesets,
+                                              const tmx::Vector2u& NewTileSize)
+{
+    ClearTileCollisionMap();
+
+    // Таблица твёрдости для каждого глобального идентификатора тайла
+    uint32_t MaxGID = 0;
+    for (const auto& Tileset : Tilesets)
+    {
+        MaxGID = std::max(MaxGID, Tileset.getLastGID());
+    }
+
+    std::vector<uint8_t> SolidByGID(static_cast<size_t>(MaxGID) + 1, 0);
+
+    for (const auto& Tileset : Tilesets)
+    {
+        // Свойство тайлсета задаёт значение по умолчанию для всех его тайлов
+        const bool bTilesetSolid = ReadSolidProperty(Tileset.getProperties(), false);
+        if (bTilesetSolid)
+        {
+            std::fill(SolidByGID.begin() + Tileset.getFirstGID(), SolidByGID.begin() + Tileset.getLastGID() + 1, 1);
+        }
+
+        // Свойство отдельного тайла переопределяет значение тайлсета
+        for (const auto& Tile : Tileset.getTiles())
+        {
+            const uint32_t TileGID = Tileset.getFirstGID() + Tile.ID;
+            if (TileGID <= MaxGID)
+            {
+                SolidByGID[TileGID] = ReadSolidProperty(Tile.properties, bTilesetSolid) ? 1 : 0;
+            }
+        }
+    }
+
+    MapSize = {static_cast<int>(TileLayer.getSize().x), static_cast<int>(TileLayer.getSize().y)};
+    TileSize = {static_cast<float>(NewTileSize.x), static_cast<float>(NewTileSize.y)};
+    WordsPerRow = (MapSize.x + 63) / 64;
+    SolidBits.assign(static_cast<size_t>(WordsPerRow) * MapSize.y, 0);
+
+    const auto& Tiles = TileLayer.getTiles();
+    for (int y = 0; y < MapSize.y; ++y)
+    {
+        for (int x = 0; x < MapSize.x; ++x)
+        {
+            const uint32_t TileGID = Tiles[static_cast<size_t>(y) * MapSize.x + x].ID;
+            if (TileGID == 0 || TileGID > MaxGID || !SolidByGID[TileGID])
+            {
+                continue;
+            }
+
+            SolidBits[static_cast<size_t>(y) * WordsPerRow + x / 64] |= uint64_t{1} << (x % 64);
+            ++SolidTileCount;
+        }
+    }
+}
+
+/**
+ * @brief Очищает битовую карту.
+ */
+void ATileCollisionMap::ClearTileCollisionMap()
+{
+    SolidBits.clear();
+    MapSize = {0, 0};
+    WordsPerRow = 0;
+    SolidTileCount = 0;
+}
+
+/**
+ * @brief Проверяет, есть ли на карте хотя бы один твёрдый тайл.
+ *
+ * @return true, если твёрдые тайлы есть, иначе false.
+ */
+bool ATileCollisionMap::HasSolidTiles() const
+{
+    return SolidTileCount > 0;
+}
+
+/**
+ * @brief Проверяет, является ли тайл твёрдым.
+ *
+ * @param TileX Координата тайла по X.
+ * @param TileY Координата тайла по Y.
+ *
+ * @return true, если тайл твёрдый, иначе false (тайлы за пределами карты не твёрдые).
+ */
+bool ATileCollisionMap::IsSolidTile(int TileX, int TileY) const
+{
+    if (TileX < 0 || TileY < 0 || TileX >= MapSize.x || TileY >= MapSize.y)
+    {
+        return false;
+    }
+
+    return (SolidBits[static_cast<size_t>(TileY) * WordsPerRow + TileX / 64] >> (TileX % 64)) & 1;
+}
+
+/**
+ * @brief Проверяет, находится ли точка внутри твёрдого тайла.
+ *
+ * @param Point Точка в координатах мира.
+ *
+ * @return true, если точка внутри твёрдого тайла, иначе false.
+ */
+bool ATileCollisionMap::IsSolidAt(const sf::Vector2f& Point) const
+{
+    return IsSolidTile(static_cast<int>(std::floor(Point.x / TileSize.x)),
+                       static_cast<int>(std::floor(Point.y / TileSize.y)));
+}
+
+/**
+ * @brief Ищет первый твёрдый тайл в отрезке строки.
+ *
+ * @param Row Номер строки тайлов.
+ * @param FirstColumn Первый столбец отрезка.
+ * @param LastColumn Последний столбец отрезка (включительно).
+ *
+ * @return Номер столбца первого твёрдого тайла или -1, если твёрдых тайлов нет.
+ */
+int ATileCollisionMap::FindSolidInRowSpan(int Row, int FirstColumn, int LastColumn) const
+{
+    if (Row < 0 || Row >= MapSize.y)
+    {
+        return -1;
+    }
+
+    FirstColumn = std::max(FirstColumn, 0);
+    LastColumn = std::min(LastColumn, MapSize.x - 1);
+
+    // Проверяем отрезок целыми словами, маскируя биты за его пределами
+    const uint64_t* RowBits = &SolidBits[static_cast<size_t>(Row) * WordsPerRow];
+    for (int Column = FirstColumn; Column <= LastColumn;)
+    {
+        const int WordIndex = Column / 64;
+        const int FirstBit = Column % 64;
+        const int LastBit = std::min(63, LastColumn - WordIndex * 64);
+
+        uint64_t Mask = ~uint64_t{0} << FirstBit;
+        if (LastBit < 63)
+        {
+            Mask &= (uint64_t{1} << (LastBit + 1)) - 1;
+        }
+
+        const uint64_t Bits = RowBits[WordIndex] & Mask;
+        if (Bits != 0)
+        {
+            return WordIndex * 64 + std::countr_zero(Bits);
+        }
+
+        Column = (WordIndex + 1) * 64;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Перемещает прямоугольник по тайлам сначала по X, затем по Y, останавливая его у твёрдых тайлов.
+ *
+ * @param Rect Прямоугольник в начальной позиции (не должен пересекать твёрдые тайлы).
+ * @param Delta Желаемое смещение.
+ *
+ * @return Смещение, которое можно выполнить без входа в твёрдые тайлы.
+ */
+sf::Vector2f ATileCollisionMap::SweepAABB(const sf::FloatRect& Rect, const sf::Vector2f& Delta) const
+{
+    if (!HasSolidTiles())
+    {
+        return Delta;
+    }
+
+    sf::Vector2f AllowedDelta;
+    AllowedDelta.x = SweepAxis(Rect, Delta.x, true);
+
+    sf::FloatRect MovedRect = Rect;
+    MovedRect.left += AllowedDelta.x;
+    AllowedDelta.y = SweepAxis(MovedRect, Delta.y, false);
+
+    return AllowedDelta;
+}
+
+/**
+ * @brief Пускает луч по тайлам и ищет первый твёрдый тайл на отрезке.
+ *
+ * @param From Начало отрезка.
+ * @param To Конец отрезка.
+ * @param OutHitFraction Доля пути от начала до точки попадания (от 0 до 1).
+ *
+ * @return true, если отрезок пересекает твёрдый тайл, иначе false.
+ */
+bool ATileCollisionMap::RaycastSolid(const sf::Vector2f& From, const sf::Vector2f& To, float& OutHitFraction) const
+{
+    if (!HasSolidTiles())
+    {
+        return false;
+    }
+
+    const sf::Vector2f Delta = To - From;
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+    // Тайлы начала и конца отрезка
+    sf::Vector2i Tile(static_cast<int>(std::floor(From.x / TileSize.x)), static_cast<int>(std::floor(From.y / TileSize.y)));
+    const sf::Vector2i LastTile(static_cast<int>(std::floor(To.x / TileSize.x)), static_cast<int>(std::floor(To.y / TileSize.y)));
+
+    // Направление шага и доля пути до ближайшей границы тайла по каждой оси (алгоритм Amanatides-Woo)
+    const sf::Vector2i Step(Delta.x > 0.f ? 1 : (Delta.x < 0.f ? -1 : 0), Delta.y > 0.f ? 1 : (Delta.y < 0.f ? -1 : 0));
+    const sf::Vector2f StepFraction(Step.x != 0 ? TileSize.x / std::abs(Delta.x) : Infinity,
+                                    Step.y != 0 ? TileSize.y / std::abs(Delta.y) : Infinity);
+    sf::Vector2f NextBoundary(Step.x != 0 ? ((Tile.x + (Step.x > 0 ? 1 : 0)) * TileSize.x - From.x) / Delta.x : Infinity,
+                              Step.y != 0 ? ((Tile.y + (Step.y > 0 ? 1 : 0)) * TileSize.y - From.y) / Delta.y : Infinity);
+
+    float EnterFraction = 0.f;
+    const int StepCount = std::abs(LastTile.x - Tile.x) + std::abs(LastTile.y - Tile.y);
+
+    for (int i = 0; i <= StepCount; ++i)
+    {
+        if (IsSolidTile(Tile.x, Tile.y))
+        {
+            OutHitFraction = EnterFraction;
+            return true;
+        }
+
+        // Переходим в соседний тайл через ближайшую границу
+        if (NextBoundary.x < NextBoundary.y)
+        {
+            EnterFraction = NextBoundary.x;
+            NextBoundary.x += StepFraction.x;
+            Tile.x += Step.x;
+        }
+        else
+        {
+            EnterFraction = NextBoundary.y;
+            NextBoundary.y += StepFraction.y;
+            Tile.y += Step.y;
+        }
+
+        if (EnterFraction > 1.f)
+        {
+            break;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Собирает прямоугольники твёрдых тайлов, пересекающих область.
+ *
+ * @param Area Область запроса.
+ * @param OutRects Вектор, в который записываются прямоугольники тайлов (предварительно очищается).
+ */
+void ATileCollisionMap::CollectSolidTileRects(const sf::FloatRect& Area, std::vector<sf::FloatRect>& OutRects) const
+{
+    OutRects.clear();
+
+    sf::Vector2i MinTile;
+    sf::Vector2i MaxTile;
+    if (!HasSolidTiles() || !GetTileRange(Area, MinTile, MaxTile))
+    {
+        return;
+    }
+
+    for (int y = MinTile.y; y <= MaxTile.y; ++y)
+    {
+        for (int x = FindSolidInRowSpan(y, MinTile.x, MaxTile.x); x >= 0; x = FindSolidInRowSpan(y, x + 1, MaxTile.x))
+        {
+            OutRects.emplace_back(x * TileSize.x, y * TileSize.y, TileSize.x, TileSize.y);
+        }
+    }
+}
+
+/**
+ * @brief Получает диапазон тайлов, которые пересекает область (ограниченный размерами карты).
+ *
+ * @param Area Область запроса.
+ * @param OutMinTile Координаты первого тайла.
+ * @param OutMaxTile Координаты последнего тайла (включительно).
+ *
+ * @return true, если область пересекает карту, иначе false.
+ */
+bool ATileCollisionMap::GetTileRange(const sf::FloatRect& Area, sf::Vector2i& OutMinTile, sf::Vector2i& OutMaxTile) const
+{
+    // Касание границы тайла не считается пересечением, как и в sf::FloatRect::intersects
+    OutMinTile.x = std::max(0, static_cast<int>(std::floor(Area.left / TileSize.x)));
+    OutMinTile.y = std::max(0, static_cast<int>(std::floor(Area.top / TileSize.y)));
+    OutMaxTile.x = std::min(MapSize.x - 1, static_cast<int>(std::ceil((Area.left + Area.width) / TileSize.x)) - 1);
+    OutMaxTile.y = std::min(MapSize.y - 1, static_cast<int>(std::ceil((Area.top + Area.height) / TileSize.y)) - 1);
+
+    return OutMinTile.x <= OutMaxTile.x && OutMinTile.y <= OutMaxTile.y;
+}
+
+/**
+ * @brief Читает булево свойство "Solid" из списка свойств.
+ *
+ * @param Properties Свойства тайла или тайлсета.
+ * @param DefaultValue Значение, если свойство не задано.
+ *
+ * @return Значение свойства или значение по умолчанию.
+ */
+bool ATileCollisionMap::ReadSolidProperty(const std::vector<tmx::Property>& Properties, bool DefaultValue)
+{
+    for (const auto& Property : Properties)
+    {
+        if (Property.getName() == TILE_SOLID_PROPERTY && Property.getType() == tmx::Property::Type::Boolean)
+        {
+            return Property.getBoolValue();
+        }
+    }
+
+    return DefaultValue;
+}
+
+/**
+ * @brief Смещает прямоугольник по одной оси, останавливая его у твёрдых тайлов.
+ *
+ * @param Rect Прямоугольник в начальной позиции.
+ * @param Delta Желаемое смещение по оси.
+ * @param bHorizontal true для оси X, false для оси Y.
+ *
+ * @return Смещение, которое можно выполнить без входа в твёрдые тайлы.
+ */
+float ATileCollisionMap::SweepAxis(const sf::FloatRect& Rect, float Delta, bool bHorizontal) const
+{
+    if (Delta == 0.f)
+    {
+        return 0.f;
+    }
+
+    // Тайлы поперёк движения, которые занимает прямоугольник (по оси движения берём всю карту)
+    sf::FloatRect CrossRect = Rect;
+    if (bHorizontal)
+    {
+        CrossRect.left = 0.f;
+        CrossRect.width = MapSize.x * TileSize.x;
+    }
+    else
+    {
+        CrossRect.top = 0.f;
+        CrossRect.height = MapSize.y * TileSize.y;
+    }
+
+    sf::Vector2i MinTile;
+    sf::Vector2i MaxTile;
+    if (!GetTileRange(CrossRect, MinTile, MaxTile))
+    {
+        return Delta;
+    }
+
+    const float AxisTileSize = bHorizontal ? TileSize.x : TileSize.y;
+    const int AxisMapSize = bHorizontal ? MapSize.x : MapSize.y;
+    const float RectMin = bHorizontal ? Rect.left : Rect.top;
+    const float RectMax = bHorizontal ? Rect.left + Rect.width : Rect.top + Rect.height;
+
+    // Проверяет линию тайлов (столбец или строку), в которую входит передний край прямоугольника
+    auto IsLineSolid = [&](int Line)
+    {
+        if (!bHorizontal)
+        {
+            return FindSolidInRowSpan(Line, MinTile.x, MaxTile.x) >= 0;
+        }
+
+        for (int y = MinTile.y; y <= MaxTile.y; ++y)
+        {
+            if (IsSolidTile(Line, y))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    if (Delta > 0.f)
+    {
+        const int FirstLine = std::max(0, static_cast<int>(std::floor(RectMax / AxisTileSize)));
+        const int LastLine = std::min(AxisMapSize - 1, static_cast<int>(std::ceil((RectMax + Delta) / AxisTileSize)) - 1);
+
+        for (int Line = FirstLine; Line <= LastLine; ++Line)
+        {
+            if (IsLineSolid(Line))
+            {
+                return std::clamp(Line * AxisTileSize - RectMax, 0.f, Delta);
+            }
+        }
+    }
+    else
+    {
+        const int FirstLine = std::min(AxisMapSize - 1, static_cast<int>(std::ceil(RectMin / AxisTileSize)) - 1);
+        const int LastLine = std::max(0, static_cast<int>(std::floor((RectMin + Delta) / AxisTileSize)));
+
+        for (int Line = FirstLine; Line >= LastLine; --Line)
+        {
+            if (IsLineSolid(Line))
+            {
+                return std::clamp((Line + 1) * AxisTileSize - RectMin, Delta, 0.f);
+            }
+        }
+    }
+
+    return Delta;
+}
@@ -0,0 +1,148 @@
+﻿#pragma once
+#include <tmxlite/TileLayer.hpp>
+#include <tmxlite/Tileset.hpp>
+#include "../Constants.h"
+
+/**
+ * @brief Битовая карта твёрдых тайлов игровой карты.
+ *
+ * Каждому тайлу слоя соответствует один бит, строки упакованы в 64-битные слова.
+ * Твёрдость тайла задаётся булевым свойством "Solid" у тайла или у всего тайлсета
+ * (свойство тайла имеет приоритет над свойством тайлсета).
+ * Стоимость запросов зависит только от количества затронутых тайлов.
+ */
+class ATileCollisionMap
+{
+public:
+    /**
+     * @brief Конструктор класса ATileCollisionMap.
+     */
+    ATileCollisionMap();
+
+    /**
+     * @brief Деструктор класса ATileCollisionMap.
+     */
+    ~ATileCollisionMap() = default;
+
+    /**
+     * @brief Строит битовую карту по тайловому слою.
+     *
+     * @param TileLayer Тайловый слой, по которому строится карта.
+     * @param Tilesets Тайлсеты карты со свойствами тайлов.
+     * @param NewTileSize Размер тайла в пикселях.
+     */
+    void BuildTileCollisionMap(const tmx::TileLayer& TileLayer,
+                               const std::vector<tmx::Tileset>& Tilesets,
+                               const tmx::Vector2u& NewTileSize);
+
+    /**
+     * @brief Очищает битовую карту.
+     */
+    void ClearTileCollisionMap();
+
+    /**
+     * @brief Проверяет, есть ли на карте хотя бы один твёрдый тайл.
+     *
+     * @return true, если твёрдые тайлы есть, иначе false.
+     */
+    bool HasSolidTiles() const;
+
+    /**
+     * @brief Проверяет, является ли тайл твёрдым.
+     *
+     * @param TileX Координата тайла по X.
+     * @param TileY Координата тайла по Y.
+     *
+     * @return true, если тайл твёрдый, иначе false (тайлы за пределами карты не твёрдые).
+     */
+    bool IsSolidTile(int TileX, int TileY) const;
+
+    /**
+     * @brief Проверяет, находится ли точка внутри твёрдого тайла.
+     *
+     * @param Point Точка в координатах мира.
+     *
+     * @return true, если точка внутри твёрдого тайла, иначе false.
+     */
+    bool IsSolidAt(const sf::Vector2f& Point) const;
+
+    /**
+     * @brief Ищет первый твёрдый тайл в отрезке строки.
+     *
+     * @param Row Номер строки тайлов.
+     * @param FirstColumn Первый столбец отрезка.
+     * @param LastColumn Последний столбец отрезка (включительно).
+     *
+     * @return Номер столбца первого твёрдого тайла или -1, если твёрдых тайлов нет.
+     */
+    int FindSolidInRowSpan(int Row, int FirstColumn, int LastColumn) const;
+
+    /**
+     * @brief Перемещает прямоугольник по тайлам сначала по X, затем по Y, останавливая его у твёрдых тайлов.
+     *
+     * @param Rect Прямоугольник в начальной позиции (не должен пересекать твёрдые тайлы).
+     * @param Delta Желаемое смещение.
+     *
+     * @return Смещение, которое можно выполнить без входа в твёрдые тайлы.
+     */
+    sf::Vector2f SweepAABB(const sf::FloatRect& Rect, const sf::Vector2f& Delta) const;
+
+    /**
+     * @brief Пускает луч по тайлам и ищет первый твёрдый тайл на отрезке.
+     *
+     * @param From Начало отрезка.
+     * @param To Конец отрезка.
+     * @param OutHitFraction Доля пути от начала до точки попадания (от 0 до 1).
+     *
+     * @return true, если отрезок пересекает твёрдый тайл, иначе false.
+     */
+    bool RaycastSolid(const sf::Vector2f& From, const sf::Vector2f& To, float& OutHitFraction) const;
+
+    /**
+     * @brief Собирает прямоугольники твёрдых тайлов, пересекающих область.
+     *
+     * @param Area Область запроса.
+     * @param OutRects Вектор, в который записываются прямоугольники тайлов (предварительно очищается).
+     */
+    void CollectSolidTileRects(const sf::FloatRect& Area, std::vector<sf::FloatRect>& OutRects) const;
+
+    /**
+     * @brief Получает диапазон тайлов, которые пересекает область (ограниченный размерами карты).
+     *
+     * @param Area Область запроса.
+     * @param OutMinTile Координаты первого тайла.
+     * @param OutMaxTile Координаты последнего тайла (включительно).
+     *
+     * @return true, если область пересекает карту, иначе false.
+     */
+    bool GetTileRange(const sf::FloatRect& Area, sf::Vector2i& OutMinTile, sf::Vector2i& OutMaxTile) const;
+
+private:
+    /**
+     * @brief Читает булево свойство "Solid" из списка свойств.
+     *
+     * @param Properties Свойства тайла или тайлсета.
+     * @param DefaultValue Значение, если свойство не задано.
+     *
+     * @return Значение свойства или значение по умолчанию.
+     */
+    static bool ReadSolidProperty(const std::vector<tmx::Property>& Properties, bool DefaultValue);
+
+    /**
+     * @brief Смещает прямоугольник по одной оси, останавливая его у твёрдых тайлов.
+     *
+     * @param Rect Прямоугольник в начальной позиции.
+     * @param Delta Желаемое смещение по оси.
+     * @param bHorizontal true для оси X, false для оси Y.
+     *
+     * @return Смещение, которое можно выполнить без входа в твёрдые тайлы.
+     */
+    float SweepAxis(const sf::FloatRect& Rect, float Delta, bool bHorizontal) const;
+
+    sf::Vector2i MapSize;                // Размер карты в тайлах
+    sf::Vector2f TileSize;               // Размер тайла в пикселях
+    int WordsPerRow;                     // Количество 64-битных слов на одну строку тайлов
+    size_t SolidTileCount;               // Количество твёрдых тайлов
+
+    std::vector<uint64_t> SolidBits;     // Упакованные биты твёрдости, по строкам
+};
@@ -0,0 +1,550 @@
+﻿#include "TileMapRenderer.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Конструктор класса ATileMapRenderer.
+ */
+ATileMapRenderer::ATileMapRenderer()
+    : MapTileSize(16.f, 16.f),
+      bUseVertexBuffer(false),
+      AnimationTime(0),
+      AnimationTimeRemainder(0.f)
+{
+}
+
+/**
+ * @brief Загружает текстуры тайлсетов карты и строит таблицу GID -> тайлсет.
+ *
+ * @param Map Карта с тайлсетами.
+ */
+void ATileMapRenderer::InitTileMapRenderer(const tmx::Map& Map)
+{
+    ClearTileMapRenderer();
+
+    bUseVertexBuffer = sf::VertexBuffer::isAvailable();
+    MapTileSize = {static_cast<float>(Map.getTileSize().x), static_cast<float>(Map.getTileSize().y)};
+
+    const auto& MapTilesets = Map.getTilesets();
+
+    // Текстуры не должны перемещаться после загрузки, поэтому место резервируется заранее
+    Tilesets.reserve(MapTilesets.size());
+
+    uint32_t MaxGID = 0;
+    for (const auto& Tileset : MapTilesets)
+    {
+        MaxGID = std::max(MaxGID, Tileset.getLastGID());
+    }
+    TilesetLookup.assign(MaxGID + 1, NO_TILESET);
+    AnimationLookup.assign(MaxGID + 1, NO_ANIMATION);
+
+    for (const auto& Tileset : MapTilesets)
+    {
+        TilesetInfo& Info = Tilesets.emplace_back();
+        if (!Info.Texture.loadFromFile(Tileset.getImagePath()))
+        {
+            throw std::runtime_error("Error: Failed to load texture: " + Tileset.getImagePath());
+        }
+
+        Info.FirstGID = Tileset.getFirstGID();
+        Info.TileSize = {static_cast<float>(Tileset.getTileSize().x), static_cast<float>(Tileset.getTileSize().y)};
+        Info.Columns = std::max(1u, Info.Texture.getSize().x / Tileset.getTileSize().x);
+
+        const uint16_t TilesetIndex = static_cast<uint16_t>(Tilesets.size() - 1);
+        std::fill(TilesetLookup.begin() + Tileset.getFirstGID(), TilesetLookup.begin() + Tileset.getLastGID() + 1,
+                  TilesetIndex);
+
+        LoadTileAnimations(Tileset, TilesetIndex);
+    }
+}
+
+/**
+ * @brief Собирает анимации тайлов тайлсета и заносит их в таблицу GID -> анимация.
+ *
+ * @param Tileset Тайлсет карты.
+ * @param TilesetIndex Индекс тайлсета.
+ */
+void ATileMapRenderer::LoadTileAnimations(const tmx::Tileset& Tileset, uint16_t TilesetIndex)
+{
+    for (const tmx::Tileset::Tile& Tile : Tileset.getTiles())
+    {
+        const auto& Frames = Tile.animation.frames;
+        if (Frames.empty())
+        {
+            continue;
+        }
+
+        TileAnimation& Animation = Animations.emplace_back();
+        Animation.TilesetIndex = TilesetIndex;
+        Animation.FrameGIDs.reserve(Frames.size());
+        Animation.FrameEndTimes.reserve(Frames.size());
+
+        // tmxlite уже переводит идентификаторы кадров в глобальные
+        uint32_t FrameEndTime = 0;
+        for (const tmx::Tileset::Tile::Animation::Frame& Frame : Frames)
+        {
+            FrameEndTime += std::max(1u, Frame.duration);
+            Animation.FrameGIDs.push_back(Frame.tileID);
+            Animation.FrameEndTimes.push_back(FrameEndTime);
+        }
+
+        AnimationLookup[Tileset.getFirstGID() + Tile.ID] = static_cast<uint16_t>(Animations.size() - 1);
+    }
+}
+
+/**
+ * @brief Строит чанки тайлового слоя, слои отрисовываются в порядке добавления.
+ *
+ * Слой со свойством LAYER_PARALLAX_PROPERTY строится как параллакс-фон.
+ *
+ * @param TileLayer Тайловый слой.
+ */
+void ATileMapRenderer::BuildTileLayer(const tmx::TileLayer& TileLayer)
+{
+    // Если узор параллакс-фона не удалось запечь, слой рисуется обычными чанками
+    for (const tmx::Property& Property : TileLayer.getProperties())
+    {
+        if (Property.getName() == LAYER_PARALLAX_PROPERTY && Property.getType() == tmx::Property::Type::Float &&
+            BuildParallaxLayer(TileLayer, Property.getFloatValue()))
+        {
+            return;
+        }
+    }
+
+    const auto& Tiles = TileLayer.getTiles();
+    const auto& LayerSize = TileLayer.getSize();
+
+    TileLayerChunks& Layer = Layers.emplace_back();
+    Layer.ChunkCount = {
+        static_cast<int>((LayerSize.x + TILE_CHUNK_SIZE - 1) / TILE_CHUNK_SIZE),
+        static_cast<int>((LayerSize.y + TILE_CHUNK_SIZE - 1) / TILE_CHUNK_SIZE)
+    };
+    Layer.ChunkMeshStart.reserve(static_cast<size_t>(Layer.ChunkCount.x * Layer.ChunkCount.y) + 1);
+
+    for (int ChunkY = 0; ChunkY < Layer.ChunkCount.y; ++ChunkY)
+    {
+        for (int ChunkX = 0; ChunkX < Layer.ChunkCount.x; ++ChunkX)
+        {
+            const uint32_t ChunkFirstMesh = static_cast<uint32_t>(Layer.Meshes.size());
+            Layer.ChunkMeshStart.push_back(ChunkFirstMesh);
+
+            const uint32_t StartX = ChunkX * TILE_CHUNK_SIZE;
+            const uint32_t StartY = ChunkY * TILE_CHUNK_SIZE;
+            const uint32_t EndX = std::min(StartX + TILE_CHUNK_SIZE, LayerSize.x);
+            const uint32_t EndY = std::min(StartY + TILE_CHUNK_SIZE, LayerSize.y);
+
+            for (uint32_t y = StartY; y < EndY; ++y)
+            {
+                for (uint32_t x = StartX; x < EndX; ++x)
+                {
+                    const uint32_t GID = Tiles[y * LayerSize.x + x].ID;
+
+                    // Пустые тайлы и тайлы без тайлсета в меш не попадают
+                    if (GID == 0 || GID >= TilesetLookup.size() || TilesetLookup[GID] == NO_TILESET)
+                    {
+                        continue;
+                    }
+
+                    // Меш тайлсета в этом чанке, в чанке обычно один-два тайлсета
+                    const uint16_t TilesetIndex = TilesetLookup[GID];
+                    auto MeshIt = std::find_if(Layer.Meshes.begin() + ChunkFirstMesh, Layer.Meshes.end(),
+                                               [TilesetIndex](const TileChunkMesh& Mesh)
+                                               {
+                                                   return Mesh.TilesetIndex == TilesetIndex;
+                                               });
+                    if (MeshIt == Layer.Meshes.end())
+                    {
+                        Layer.Meshes.emplace_back().TilesetIndex = TilesetIndex;
+                        MeshIt = Layer.Meshes.end() - 1;
+                    }
+
+                    // Анимированный тайл запоминается по положению его вершин в меше и сразу показывает
+                    // текущий кадр анимации, так как тайл кадра может отличаться от самого тайла
+                    uint32_t DrawGID = GID;
+                    if (AnimationLookup[GID] != NO_ANIMATION)
+                    {
+                        Layer.AnimatedTiles.push_back({
+                            static_cast<uint32_t>(MeshIt - Layer.Meshes.begin()),
+                            static_cast<uint32_t>(MeshIt->Vertices.size()),
+                            AnimationLookup[GID]
+                        });
+
+                        const TileAnimation& Animation = Animations[AnimationLookup[GID]];
+                        DrawGID = Animation.FrameGIDs[Animation.CurrentFrame];
+                    }
+
+                    AppendTile(*MeshIt, x, y, DrawGID);
+                }
+            }
+        }
+    }
+    Layer.ChunkMeshStart.push_back(static_cast<uint32_t>(Layer.Meshes.size()));
+
+    // Меши больше не перемещаются, копируем их вершины в видеопамять
+    if (bUseVertexBuffer)
+    {
+        Layer.MeshBuffers.reserve(Layer.Meshes.size());
+        for (const TileChunkMesh& Mesh : Layer.Meshes)
+        {
+            sf::VertexBuffer& MeshBuffer = Layer.MeshBuffers.emplace_back(sf::Triangles, sf::VertexBuffer::Static);
+            if (!MeshBuffer.create(Mesh.Vertices.size()) || !MeshBuffer.update(Mesh.Vertices.data()))
+            {
+                throw std::runtime_error("Error: Failed to create vertex buffer for tile layer: " + TileLayer.getName());
+            }
+        }
+    }
+}
+
+/**
+ * @brief Строит параллакс-фон из тайлового слоя.
+ *
+ * @param TileLayer Тайловый слой.
+ * @param ScrollFactor Коэффициент прокрутки относительно камеры по X.
+ *
+ * @return true, если фон построен, false, если слой пуст или узор не удалось запечь в текстуру.
+ */
+bool ATileMapRenderer::BuildParallaxLayer(const tmx::TileLayer& TileLayer, float ScrollFactor)
+{
+    const auto& Tiles = TileLayer.getTiles();
+    const auto& LayerSize = TileLayer.getSize();
+
+    const auto IsDrawableTile = [this](uint32_t GID)
+    {
+        return GID != 0 && GID < TilesetLookup.size() && TilesetLookup[GID] != NO_TILESET;
+    };
+
+    // Непустая область слоя
+    sf::Vector2u BoundsMin(LayerSize.x, LayerSize.y);
+    sf::Vector2u BoundsMax(0, 0);
+    for (uint32_t y = 0; y < LayerSize.y; ++y)
+    {
+        for (uint32_t x = 0; x < LayerSize.x; ++x)
+        {
+            if (IsDrawableTile(Tiles[y * LayerSize.x + x].ID))
+            {
+                BoundsMin = {std::min(BoundsMin.x, x), std::min(BoundsMin.y, y)};
+                BoundsMax = {std::max(BoundsMax.x, x), std::max(BoundsMax.y, y)};
+            }
+        }
+    }
+
+    if (BoundsMin.x > BoundsMax.x)
+    {
+        return false;
+    }
+
+    const sf::IntRect Bounds(static_cast<int>(BoundsMin.x), static_cast<int>(BoundsMin.y),
+                             static_cast<int>(BoundsMax.x - BoundsMin.x + 1), static_cast<int>(BoundsMax.y - BoundsMin.y + 1));
+    const uint32_t Period = FindRepeatPeriod(TileLayer, Bounds);
+
+    const sf::Vector2u PatternSize(static_cast<unsigned int>(static_cast<float>(Period) * MapTileSize.x),
+                                   static_cast<unsigned int>(static_cast<float>(Bounds.height) * MapTileSize.y));
+    if (PatternSize.x > sf::Texture::getMaximumSize() || PatternSize.y > sf::Texture::getMaximumSize())
+    {
+        return false;
+    }
+
+    // Тайлы одного периода собираются в меши по тайлсетам в координатах относительно начала периода
+    std::vector<TileChunkMesh> PatternMeshes;
+    for (uint32_t y = BoundsMin.y; y <= BoundsMax.y; ++y)
+    {
+        for (uint32_t x = BoundsMin.x; x < BoundsMin.x + Period; ++x)
+        {
+            const uint32_t GID = Tiles[y * LayerSize.x + x].ID;
+            if (!IsDrawableTile(GID))
+            {
+                continue;
+            }
+
+            const uint16_t TilesetIndex = TilesetLookup[GID];
+            auto MeshIt = std::find_if(PatternMeshes.begin(), PatternMeshes.end(),
+                                       [TilesetIndex](const TileChunkMesh& Mesh)
+                                       {
+                                           return Mesh.TilesetIndex == TilesetIndex;
+                                       });
+            if (MeshIt == PatternMeshes.end())
+            {
+                PatternMeshes.emplace_back().TilesetIndex = TilesetIndex;
+                MeshIt = PatternMeshes.end() - 1;
+            }
+
+            AppendTile(*MeshIt, x - BoundsMin.x, y - BoundsMin.y, GID);
+        }
+    }
+
+    sf::RenderTexture PatternTarget;
+    if (!PatternTarget.create(PatternSize.x, PatternSize.y))
+    {
+        return false;
+    }
+
+    PatternTarget.clear(sf::Color::Transparent);
+    for (const TileChunkMesh& Mesh : PatternMeshes)
+    {
+        PatternTarget.draw(Mesh.Vertices.data(), Mesh.Vertices.size(), sf::Triangles,
+                           sf::RenderStates(&Tilesets[Mesh.TilesetIndex].Texture));
+    }
+    PatternTarget.display();
+
+    ParallaxLayer& Parallax = ParallaxLayers.emplace_back();
+    Parallax.Texture = PatternTarget.getTexture();
+    Parallax.Origin = {static_cast<float>(Bounds.left) * MapTileSize.x, static_cast<float>(Bounds.top) * MapTileSize.y};
+    Parallax.Width = static_cast<float>(Bounds.width) * MapTileSize.x;
+    Parallax.ScrollFactor = ScrollFactor;
+
+    // Повтор нужен только там, где столбцы слоя действительно повторяются с найденным периодом
+    Parallax.Texture.setRepeated(Period < static_cast<uint32_t>(Bounds.width));
+    return true;
+}
+
+/**
+ * @brief Поиск наименьшего периода, с которым столбцы слоя повторяются по X.
+ *
+ * @param TileLayer Тайловый слой.
+ * @param Bounds Непустая область слоя в тайлах.
+ *
+ * @return Период в тайлах, ширина области, если узор не повторяется.
+ */
+uint32_t ATileMapRenderer::FindRepeatPeriod(const tmx::TileLayer& TileLayer, const sf::IntRect& Bounds)
+{
+    const auto& Tiles = TileLayer.getTiles();
+    const uint32_t LayerWidth = TileLayer.getSize().x;
+    const uint32_t Left = static_cast<uint32_t>(Bounds.left);
+    const uint32_t Right = static_cast<uint32_t>(Bounds.left + Bounds.width);
+    const uint32_t Top = static_cast<uint32_t>(Bounds.top);
+    const uint32_t Bottom = static_cast<uint32_t>(Bounds.top + Bounds.height);
+
+    for (uint32_t Period = 1; Period < Right - Left; ++Period)
+    {
+        bool bIsRepeating = true;
+        for (uint32_t y = Top; y < Bottom && bIsRepeating; ++y)
+        {
+            const size_t RowStart = static_cast<size_t>(y) * LayerWidth;
+            for (uint32_t x = Left; x + Period < Right; ++x)
+            {
+                if (Tiles[RowStart + x].ID != Tiles[RowStart + x + Period].ID)
+                {
+                    bIsRepeating = false;
+                    break;
+                }
+            }
+        }
+
+        if (bIsRepeating)
+        {
+            return Period;
+        }
+    }
+
+    return Right - Left;
+}
+
+/**
+ * @brief Добавляет тайл в меш в виде двух треугольников.
+ *
+ * @param Mesh Меш чанка.
+ * @param TileX Координата тайла по X.
+ * @param TileY Координата тайла по Y.
+ * @param GID Глобальный идентификатор тайла.
+ */
+void ATileMapRenderer::AppendTile(TileChunkMesh& Mesh, uint32_t TileX, uint32_t TileY, uint32_t GID) const
+{
+    const float Left = static_cast<float>(TileX) * MapTileSize.x;
+    const float Top = static_cast<float>(TileY) * MapTileSize.y;
+    const float Right = Left + MapTileSize.x;
+    const float Bottom = Top + MapTileSize.y;
+
+    const size_t FirstVertex = Mesh.Vertices.size();
+    Mesh.Vertices.emplace_back(sf::Vector2f(Left, Top));
+    Mesh.Vertices.emplace_back(sf::Vector2f(Right, Top));
+    Mesh.Vertices.emplace_back(sf::Vector2f(Right, Bottom));
+
+    Mesh.Vertices.emplace_back(sf::Vector2f(Left, Top));
+    Mesh.Vertices.emplace_back(sf::Vector2f(Right, Bottom));
+    Mesh.Vertices.emplace_back(sf::Vector2f(Left, Bottom));
+
+    SetTileTexCoords(&Mesh.Vertices[FirstVertex], Tilesets[Mesh.TilesetIndex], GID);
+}
+
+/**
+ * @brief Записывает текстурные координаты тайла в его шесть вершин.
+ *
+ * @param TileVertices Первая из шести вершин тайла.
+ * @param Tileset Тайлсет тайла.
+ * @param GID Глобальный идентификатор тайла.
+ */
+void ATileMapRenderer::SetTileTexCoords(sf::Vertex* TileVertices, const TilesetInfo& Tileset, uint32_t GID)
+{
+    // Рассчитываем координаты текстуры
+    const uint32_t LocalTileID = GID - Tileset.FirstGID;
+    const float TextureLeft = static_cast<float>(LocalTileID % Tileset.Columns) * Tileset.TileSize.x;
+    const float TextureTop = static_cast<float>(LocalTileID / Tileset.Columns) * Tileset.TileSize.y;
+    const float TextureRight = TextureLeft + Tileset.TileSize.x;
+    const float TextureBottom = TextureTop + Tileset.TileSize.y;
+
+    // Порядок совпадает с порядком вершин в AppendTile
+    TileVertices[0].texCoords = {TextureLeft, TextureTop};
+    TileVertices[1].texCoords = {TextureRight, TextureTop};
+    TileVertices[2].texCoords = {TextureRight, TextureBottom};
+    TileVertices[3].texCoords = {TextureLeft, TextureTop};
+    TileVertices[4].texCoords = {TextureRight, TextureBottom};
+    TileVertices[5].texCoords = {TextureLeft, TextureBottom};
+}
+
+/**
+ * @brief Удаляет все чанки и текстуры тайлсетов.
+ */
+void ATileMapRenderer::ClearTileMapRenderer()
+{
+    Layers.clear();
+    ParallaxLayers.clear();
+    TilesetLookup.clear();
+    AnimationLookup.clear();
+    Animations.clear();
+    Tilesets.clear();
+
+    AnimationTime = 0;
+    AnimationTimeRemainder = 0.f;
+}
+
+/**
+ * @brief Продвигает анимации тайлов и обновляет текстурные координаты тайлов, у которых сменился кадр.
+ *
+ * @param DeltaTime Время, прошедшее с последнего обновления.
+ */
+void ATileMapRenderer::UpdateTileAnimations(float DeltaTime)
+{
+    if (Animations.empty())
+    {
+        return;
+    }
+
+    // Длительности кадров Tiled заданы в миллисекундах
+    AnimationTimeRemainder += DeltaTime * 1000.f;
+    const uint32_t ElapsedMilliseconds = static_cast<uint32_t>(AnimationTimeRemainder);
+    AnimationTimeRemainder -= static_cast<float>(ElapsedMilliseconds);
+    AnimationTime += ElapsedMilliseconds;
+
+    bool bIsAnyFrameChanged = false;
+    for (TileAnimation& Animation : Animations)
+    {
+        const uint32_t CycleTime = AnimationTime % Animation.FrameEndTimes.back();
+        const uint32_t Frame = static_cast<uint32_t>(
+            std::upper_bound(Animation.FrameEndTimes.begin(), Animation.FrameEndTimes.end(), CycleTime) -
+            Animation.FrameEndTimes.begin());
+
+        Animation.bIsFrameChanged = Frame != Animation.CurrentFrame;
+        Animation.CurrentFrame = Frame;
+        bIsAnyFrameChanged |= Animation.bIsFrameChanged;
+    }
+
+    // Пока ни одна анимация не сменила кадр, меши не трогаются
+    if (!bIsAnyFrameChanged)
+    {
+        return;
+    }
+
+    for (TileLayerChunks& Layer : Layers)
+    {
+        for (const AnimatedTileVertices& AnimatedTile : Layer.AnimatedTiles)
+        {
+            const TileAnimation& Animation = Animations[AnimatedTile.AnimationIndex];
+            if (!Animation.bIsFrameChanged)
+            {
+                continue;
+            }
+
+            TileChunkMesh& Mesh = Layer.Meshes[AnimatedTile.MeshIndex];
+            sf::Vertex* TileVertices = &Mesh.Vertices[AnimatedTile.FirstVertex];
+            SetTileTexCoords(TileVertices, Tilesets[Animation.TilesetIndex], Animation.FrameGIDs[Animation.CurrentFrame]);
+
+            // В видеопамять копируются только шесть вершин тайла, остальной меш остаётся прежним
+            if (bUseVertexBuffer)
+            {
+                Layer.MeshBuffers[AnimatedTile.MeshIndex].update(TileVertices, 6, AnimatedTile.FirstVertex);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Отрисовывает чанки всех слоёв, которые пересекают текущую камеру цели отрисовки.
+ *
+ * @param Target Цель отрисовки (окно) с установленной камерой.
+ */
+void ATileMapRenderer::DrawTileMap(sf::RenderTarget& Target) const
+{
+    const sf::View& View = Target.getView();
+    const sf::Vector2f ViewTopLeft = View.getCenter() - View.getSize() / 2.f;
+    const sf::Vector2f ViewBottomRight = View.getCenter() + View.getSize() / 2.f;
+
+    // Диапазон чанков, которые видит камера
+    const sf::Vector2f ChunkWorldSize = MapTileSize * static_cast<float>(TILE_CHUNK_SIZE);
+    const int MinChunkX = static_cast<int>(std::floor(ViewTopLeft.x / ChunkWorldSize.x));
+    const int MinChunkY = static_cast<int>(std::floor(ViewTopLeft.y / ChunkWorldSize.y));
+    const int MaxChunkX = static_cast<int>(std::floor(ViewBottomRight.x / ChunkWorldSize.x));
+    const int MaxChunkY = static_cast<int>(std::floor(ViewBottomRight.y / ChunkWorldSize.y));
+
+    sf::RenderStates States;
+
+    // Параллакс-фон - один прямоугольник в пределах области слоя, попавшей в камеру
+    for (const ParallaxLayer& Parallax : ParallaxLayers)
+    {
+        // Слой отстаёт от карты на долю (1 - ScrollFactor) движения камеры,
+        // при камере у левого края карты слой стоит на своём месте
+        const float LayerLeft = Parallax.Origin.x + ViewTopLeft.x * (1.f - Parallax.ScrollFactor);
+        const float Left = std::max(ViewTopLeft.x, LayerLeft);
+        const float Right = std::min(ViewBottomRight.x, LayerLeft + Parallax.Width);
+        if (Left >= Right)
+        {
+            continue;
+        }
+
+        const float TextureLeft = Left - LayerLeft;
+        const float TextureRight = Right - LayerLeft;
+        const float Top = Parallax.Origin.y;
+        const float Bottom = Top + static_cast<float>(Parallax.Texture.getSize().y);
+        const float TextureBottom = Bottom - Top;
+
+        const sf::Vertex Quad[4] = {
+            sf::Vertex(sf::Vector2f(Left, Top), sf::Vector2f(TextureLeft, 0.f)),
+            sf::Vertex(sf::Vector2f(Right, Top), sf::Vector2f(TextureRight, 0.f)),
+            sf::Vertex(sf::Vector2f(Left, Bottom), sf::Vector2f(TextureLeft, TextureBottom)),
+            sf::Vertex(sf::Vector2f(Right, Bottom), sf::Vector2f(TextureRight, TextureBottom))
+        };
+
+        States.texture = &Parallax.Texture;
+        Target.draw(Quad, 4, sf::TriangleStrip, States);
+    }
+
+    for (const TileLayerChunks& Layer : Layers)
+    {
+        const int FirstX = std::max(MinChunkX, 0);
+        const int FirstY = std::max(MinChunkY, 0);
+        const int LastX = std::min(MaxChunkX, Layer.ChunkCount.x - 1);
+        const int LastY = std::min(MaxChunkY, Layer.ChunkCount.y - 1);
+
+        for (int ChunkY = FirstY; ChunkY <= LastY; ++ChunkY)
+        {
+            for (int ChunkX = FirstX; ChunkX <= LastX; ++ChunkX)
+            {
+                const size_t ChunkIndex = static_cast<size_t>(ChunkY * Layer.ChunkCount.x + ChunkX);
+                for (uint32_t MeshIndex = Layer.ChunkMeshStart[ChunkIndex];
+                     MeshIndex < Layer.ChunkMeshStart[ChunkIndex + 1]; ++MeshIndex)
+                {
+                    const TileChunkMesh& Mesh = Layer.Meshes[MeshIndex];
+                    States.texture = &Tilesets[Mesh.TilesetIndex].Texture;
+
+                    if (bUseVertexBuffer)
+                    {
+                        Target.draw(Layer.MeshBuffers[MeshIndex], States);
+                    }
+                    else
+                    {
+                        Target.draw(Mesh.Vertices.data(), Mesh.Vertices.size(), sf::Triangles, States);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,198 @@
+﻿#pragma once
+#include <tmxlite/Map.hpp>
+#include <tmxlite/TileLayer.hpp>
+#include "../Constants.h"
+
+/**
+ * @brief Отрисовка тайловых слоёв карты по чанкам.
+ *
+ * Каждый слой делится на чанки по TILE_CHUNK_SIZE x TILE_CHUNK_SIZE тайлов, в чанк попадают только непустые тайлы,
+ * по одному мешу на каждый тайлсет чанка. Меши хранятся в видеопамяти (sf::VertexBuffer), если она поддерживается,
+ * а за кадр отрисовываются только чанки, которые пересекают текущую камеру.
+ * Тайлсет тайла определяется по таблице GID -> тайлсет без перебора тайлсетов.
+ * Для анимированных тайлов (анимации тайлсетов Tiled) при построении запоминаются только положения их вершин,
+ * а при смене кадра анимации переписываются текстурные координаты только этих вершин.
+ * Слой со свойством LAYER_PARALLAX_PROPERTY становится параллакс-фоном: непустая область слоя запекается в текстуру
+ * (если столбцы области повторяются, то только один период с повтором текстуры), и слой рисуется одним прямоугольником
+ * в пределах своей области. Параллакс-фоны рисуются раньше всех тайловых слоёв.
+ */
+class ATileMapRenderer
+{
+public:
+    /**
+     * @brief Конструктор класса ATileMapRenderer.
+     */
+    ATileMapRenderer();
+
+    /**
+     * @brief Деструктор класса ATileMapRenderer.
+     */
+    ~ATileMapRenderer() = default;
+
+    /**
+     * @brief Загружает текстуры тайлсетов карты и строит таблицу GID -> тайлсет.
+     *
+     * @param Map Карта с тайлсетами.
+     */
+    void InitTileMapRenderer(const tmx::Map& Map);
+
+    /**
+     * @brief Строит чанки тайлового слоя, слои отрисовываются в порядке добавления.
+     *
+     * Слой со свойством LAYER_PARALLAX_PROPERTY строится как параллакс-фон.
+     *
+     * @param TileLayer Тайловый слой.
+     */
+    void BuildTileLayer(const tmx::TileLayer& TileLayer);
+
+    /**
+     * @brief Удаляет все чанки и текстуры тайлсетов.
+     */
+    void ClearTileMapRenderer();
+
+    /**
+     * @brief Продвигает анимации тайлов и обновляет текстурные координаты тайлов, у которых сменился кадр.
+     *
+     * @param DeltaTime Время, прошедшее с последнего обновления.
+     */
+    void UpdateTileAnimations(float DeltaTime);
+
+    /**
+     * @brief Отрисовывает чанки всех слоёв, которые пересекают текущую камеру цели отрисовки.
+     *
+     * @param Target Цель отрисовки (окно) с установленной камерой.
+     */
+    void DrawTileMap(sf::RenderTarget& Target) const;
+
+private:
+    /**
+     * @brief Тайлсет с загруженной текстурой.
+     */
+    struct TilesetInfo
+    {
+        sf::Texture Texture;                    // Текстура тайлсета
+        uint32_t FirstGID = 0;                  // Глобальный идентификатор первого тайла
+        uint32_t Columns = 1;                   // Количество тайлов в строке текстуры
+        sf::Vector2f TileSize;                  // Размер тайла в текстуре
+    };
+
+    /**
+     * @brief Анимация тайла из тайлсета, общая для всех тайлов с этим GID.
+     */
+    struct TileAnimation
+    {
+        uint16_t TilesetIndex = 0;              // Индекс тайлсета анимации
+        std::vector<uint32_t> FrameGIDs;        // Глобальные идентификаторы тайлов кадров
+        std::vector<uint32_t> FrameEndTimes;    // Время окончания каждого кадра от начала цикла (мс)
+        uint32_t CurrentFrame = 0;              // Текущий кадр
+        bool bIsFrameChanged = false;           // Флаг, сменился ли кадр в этом обновлении
+    };
+
+    /**
+     * @brief Положение анимированного тайла в мешах слоя.
+     */
+    struct AnimatedTileVertices
+    {
+        uint32_t MeshIndex = 0;                 // Индекс меша в слое
+        uint32_t FirstVertex = 0;               // Первая из шести вершин тайла в меше
+        uint16_t AnimationIndex = 0;            // Индекс анимации тайла
+    };
+
+    /**
+     * @brief Меш тайлов одного тайлсета внутри чанка.
+     */
+    struct TileChunkMesh
+    {
+        uint16_t TilesetIndex = 0;              // Индекс тайлсета, текстура которого используется
+        std::vector<sf::Vertex> Vertices;       // Вершины тайлов (по два треугольника на тайл)
+    };
+
+    /**
+     * @brief Чанки одного тайлового слоя.
+     *
+     * Меши всех чанков лежат подряд, меши чанка с индексом i занимают диапазон [ChunkMeshStart[i], ChunkMeshStart[i + 1]).
+     */
+    struct TileLayerChunks
+    {
+        sf::Vector2i ChunkCount;                // Количество чанков по X и Y
+        std::vector<uint32_t> ChunkMeshStart;   // Начало мешей каждого чанка
+        std::vector<TileChunkMesh> Meshes;      // Меши всех чанков слоя
+        std::vector<sf::VertexBuffer> MeshBuffers; // Копии вершин мешей в видеопамяти, индекс совпадает с индексом меша
+        std::vector<AnimatedTileVertices> AnimatedTiles; // Анимированные тайлы слоя
+    };
+
+    /**
+     * @brief Параллакс-фон: непустая область слоя, запечённая в текстуру.
+     *
+     * Если область шире текстуры, то её столбцы повторяются с периодом в ширину текстуры и текстура повторяется по X.
+     */
+    struct ParallaxLayer
+    {
+        sf::Texture Texture;                    // Текстура одного периода области слоя
+        sf::Vector2f Origin;                    // Положение области слоя на карте
+        float Width = 0.f;                      // Ширина области слоя на карте
+        float ScrollFactor = 1.f;               // Коэффициент прокрутки относительно камеры по X
+    };
+
+    /**
+     * @brief Строит параллакс-фон из тайлового слоя.
+     *
+     * @param TileLayer Тайловый слой.
+     * @param ScrollFactor Коэффициент прокрутки относительно камеры по X.
+     *
+     * @return true, если фон построен, false, если слой пуст или узор не удалось запечь в текстуру.
+     */
+    bool BuildParallaxLayer(const tmx::TileLayer& TileLayer, float ScrollFactor);
+
+    /**
+     * @brief Поиск наименьшего периода, с которым столбцы слоя повторяются по X.
+     *
+     * @param TileLayer Тайловый слой.
+     * @param Bounds Непустая область слоя в тайлах.
+     *
+     * @return Период в тайлах, ширина области, если узор не повторяется.
+     */
+    static uint32_t FindRepeatPeriod(const tmx::TileLayer& TileLayer, const sf::IntRect& Bounds);
+
+    /**
+     * @brief Добавляет тайл в меш в виде двух треугольников.
+     *
+     * @param Mesh Меш чанка.
+     * @param TileX Координата тайла по X.
+     * @param TileY Координата тайла по Y.
+     * @param GID Глобальный идентификатор тайла.
+     */
+    void AppendTile(TileChunkMesh& Mesh, uint32_t TileX, uint32_t TileY, uint32_t GID) const;
+
+    /**
+     * @brief Записывает текстурные координаты тайла в его шесть вершин.
+     *
+     * @param TileVertices Первая из шести вершин тайла.
+     * @param Tileset Тайлсет тайла.
+     * @param GID Глобальный идентификатор тайла.
+     */
+    static void SetTileTexCoords(sf::Vertex* TileVertices, const TilesetInfo& Tileset, uint32_t GID);
+
+    /**
+     * @brief Собирает анимации тайлов тайлсета и заносит их в таблицу GID -> анимация.
+     *
+     * @param Tileset Тайлсет карты.
+     * @param TilesetIndex Индекс тайлсета.
+     */
+    void LoadTileAnimations(const tmx::Tileset& Tileset, uint16_t TilesetIndex);
+
+    static constexpr uint16_t NO_TILESET = UINT16_MAX;  // Значение таблицы для GID без тайлсета
+    static constexpr uint16_t NO_ANIMATION = UINT16_MAX; // Значение таблицы для GID без анимации
+
+    sf::Vector2f MapTileSize;                   // Размер тайла карты в пикселях
+    bool bUseVertexBuffer;                      // Флаг, хранятся ли меши в видеопамяти
+
+    std::vector<TilesetInfo> Tilesets;          // Тайлсеты с текстурами
+    std::vector<uint16_t> TilesetLookup;        // Индекс тайлсета для каждого GID
+    std::vector<uint16_t> AnimationLookup;      // Индекс анимации для каждого GID
+    std::vector<TileAnimation> Animations;      // Анимации тайлов всех тайлсетов
+    uint32_t AnimationTime;                     // Время, прошедшее с начала анимаций (мс)
+    float AnimationTimeRemainder;               // Доля миллисекунды, не вошедшая в AnimationTime
+    std::vector<TileLayerChunks> Layers;        // Чанки тайловых слоёв в порядке отрисовки
+    std::vector<ParallaxLayer> ParallaxLayers;  // Параллакс-фоны в порядке отрисовки
+};
@@ -0,0 +1,57 @@
+﻿#include "TriggerVolumeLayer.h"
+
+/**
+ * @brief Инициализация слоя для области карты.
+ *
+ * @param MapBounds Область карты, которую покрывает сетка слоя.
+ */
+void ATriggerVolumeLayer::InitTriggerVolumeLayer(const sf::FloatRect& MapBounds)
+{
+    Triggers.clear();
+    TriggerRectSoA.ClearRectSoA();
+    TriggerGrid.InitGrid(MapBounds, COLLISION_GRID_CELL_SIZE);
+}
+
+/**
+ * @brief Добавляет зону-триггер.
+ *
+ * @param TriggerType Тип зоны.
+ * @param TriggerRect Прямоугольник зоны.
+ *
+ * @return Идентификатор добавленной зоны.
+ */
+uint32_t ATriggerVolumeLayer::AddTrigger(ETriggerType TriggerType, const sf::FloatRect& TriggerRect)
+{
+    const uint32_t TriggerID = static_cast<uint32_t>(Triggers.size());
+    Triggers.push_back({TriggerType, TriggerRect});
+    TriggerGrid.InsertRect(TriggerID, TriggerRect);
+    TriggerRectSoA.AddRect(TriggerRect);
+
+    return TriggerID;
+}
+
+/**
+ * @brief Собирает идентификаторы зон, которые пересекают область.
+ *
+ * @param Area Область запроса.
+ * @param OutTriggerIDs Вектор, в который записываются идентификаторы по возрастанию (предварительно очищается).
+ */
+void ATriggerVolumeLayer::QueryTriggers(const sf::FloatRect& Area, std::vector<uint32_t>& OutTriggerIDs) const
+{
+    TriggerGrid.QueryRect(Area, OutTriggerIDs);
+
+    // В ячейках лежат все зоны рядом, оставляем только те, что действительно пересекают область
+    TriggerRectSoA.FilterIntersecting(Area, OutTriggerIDs);
+
+    std::sort(OutTriggerIDs.begin(), OutTriggerIDs.end());
+}
+
+/**
+ * @brief Удаляет все зоны и очищает сетку.
+ */
+void ATriggerVolumeLayer::ClearTriggerVolumes()
+{
+    Triggers.clear();
+    TriggerRectSoA.ClearRectSoA();
+    TriggerGrid.ClearGrid();
+}
@@ -0,0 +1,172 @@
+﻿#pragma once
+#include <algorithm>
+#include "../Constants.h"
+#include "SpatialGrid.h"
+#include "RectSoA.h"
+
+/**
+ * @brief Тип зоны-триггера карты.
+ */
+enum class ETriggerType
+{
+    ETT_LavaDamage,
+    ETT_PeaksDamage,
+    ETT_Ladder,
+    ETT_SoundHelicopter,
+    ETT_MissionAccomplished
+};
+
+/**
+ * @brief Событие пересечения актера с зоной-триггером.
+ */
+enum class ETriggerEvent
+{
+    ETE_Enter,
+    ETE_Stay,
+    ETE_Exit
+};
+
+/**
+ * @brief Зона-триггер карты (лава, пики, лестница, зона вертолёта, финиш).
+ */
+struct TriggerVolume
+{
+    ETriggerType TriggerType = ETriggerType::ETT_Ladder;    // Тип зоны
+    sf::FloatRect TriggerRect;                              // Прямоугольник зоны
+};
+
+/**
+ * @brief Состояние пересечений одного актера с зонами-триггерами.
+ *
+ * Хранит отсортированные идентификаторы зон, которые актер пересекал в прошлом кадре.
+ * Векторы переиспользуются между кадрами, поэтому обновление не выделяет память.
+ */
+struct TriggerOverlapState
+{
+    std::vector<uint32_t> OverlappingTriggers;  // Зоны, которые актер пересекает сейчас
+    std::vector<uint32_t> CurrentTriggers;      // Зоны текущего кадра, используются при обновлении
+
+    /**
+     * @brief Сбрасывает пересечения, например, при перезапуске игры.
+     */
+    void ClearOverlaps()
+    {
+        OverlappingTriggers.clear();
+        CurrentTriggers.clear();
+    }
+};
+
+/**
+ * @brief Слой зон-триггеров карты.
+ *
+ * Зоны строятся из слоёв объектов карты и хранятся в сетке, поэтому проверка актера
+ * затрагивает только ближайшие зоны. События входа и выхода вызываются один раз при изменении пересечения,
+ * событие нахождения вызывается каждый кадр, пока актер остаётся в зоне.
+ */
+class ATriggerVolumeLayer
+{
+public:
+    /**
+     * @brief Конструктор класса ATriggerVolumeLayer.
+     */
+    ATriggerVolumeLayer() = default;
+
+    /**
+     * @brief Деструктор класса ATriggerVolumeLayer.
+     */
+    ~ATriggerVolumeLayer() = default;
+
+    /**
+     * @brief Инициализация слоя для области карты.
+     *
+     * @param MapBounds Область карты, которую покрывает сетка слоя.
+     */
+    void InitTriggerVolumeLayer(const sf::FloatRect& MapBounds);
+
+    /**
+     * @brief Добавляет зону-триггер.
+     *
+     * @param TriggerType Тип зоны.
+     * @param TriggerRect Прямоугольник зоны.
+     *
+     * @return Идентификатор добавленной зоны.
+     */
+    uint32_t AddTrigger(ETriggerType TriggerType, const sf::FloatRect& TriggerRect);
+
+    /**
+     * @brief Собирает идентификаторы зон, которые пересекают область.
+     *
+     * @param Area Область запроса.
+     * @param OutTriggerIDs Вектор, в который записываются идентификаторы по возрастанию (предварительно очищается).
+     */
+    void QueryTriggers(const sf::FloatRect& Area, std::vector<uint32_t>& OutTriggerIDs) const;
+
+    /**
+     * @brief Обновляет пересечения актера с зонами и вызывает события входа, нахождения и выхода.
+     *
+     * @param ActorRect Прямоугольник коллизии актера.
+     * @param OverlapState Состояние пересечений этого актера.
+     * @param OnTriggerEvent Обработчик вида void(ETriggerEvent, const TriggerVolume&).
+     */
+    template <typename TriggerEventHandler>
+    void UpdateOverlaps(const sf::FloatRect& ActorRect,
+                        TriggerOverlapState& OverlapState,
+                        TriggerEventHandler&& OnTriggerEvent) const;
+
+    /**
+     * @brief Удаляет все зоны и очищает сетку.
+     */
+    void ClearTriggerVolumes();
+
+private:
+    std::vector<TriggerVolume> Triggers;    // Зоны-триггеры карты
+    ASpatialGrid TriggerGrid;               // Сетка для быстрого поиска зон рядом с актером
+    ARectSoA TriggerRectSoA;                // Границы зон по массивам для пакетной проверки
+};
+
+/**
+ * @brief Обновляет пересечения актера с зонами и вызывает события входа, нахождения и выхода.
+ *
+ * @param ActorRect Прямоугольник коллизии актера.
+ * @param OverlapState Состояние пересечений этого актера.
+ * @param OnTriggerEvent Обработчик вида void(ETriggerEvent, const TriggerVolume&).
+ */
+template <typename TriggerEventHandler>
+void ATriggerVolumeLayer::UpdateOverlaps(const sf::FloatRect& ActorRect,
+                                         TriggerOverlapState& OverlapState,
+                                         TriggerEventHandler&& OnTriggerEvent) const
+{
+    std::vector<uint32_t>& Current = OverlapState.CurrentTriggers;
+    const std::vector<uint32_t>& Previous = OverlapState.OverlappingTriggers;
+
+    QueryTriggers(ActorRect, Current);
+
+    // Оба списка отсортированы, поэтому события находятся одним проходом слиянием
+    size_t CurrentIndex = 0;
+    size_t PreviousIndex = 0;
+    while (CurrentIndex < Current.size() || PreviousIndex < Previous.size())
+    {
+        if (PreviousIndex == Previous.size() ||
+            (CurrentIndex < Current.size() && Current[CurrentIndex] < Previous[PreviousIndex]))
+        {
+            OnTriggerEvent(ETriggerEvent::ETE_Enter, Triggers[Current[CurrentIndex++]]);
+        }
+        else if (CurrentIndex == Current.size() || Previous[PreviousIndex] < Current[CurrentIndex])
+        {
+            // Зоны могли быть перестроены после сброса карты, устаревшие идентификаторы пропускаем
+            const uint32_t TriggerID = Previous[PreviousIndex++];
+            if (TriggerID < Triggers.size())
+            {
+                OnTriggerEvent(ETriggerEvent::ETE_Exit, Triggers[TriggerID]);
+            }
+        }
+        else
+        {
+            OnTriggerEvent(ETriggerEvent::ETE_Stay, Triggers[Current[CurrentIndex]]);
+            ++CurrentIndex;
+            ++PreviousIndex;
+        }
+    }
+
+    std::swap(OverlapState.OverlappingTriggers, OverlapState.CurrentTriggers);
+}
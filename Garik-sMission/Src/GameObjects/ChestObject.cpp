@@ -10,8 +10,7 @@ int AChestObject::ChestOpenCountStatic = 0;
 */
 AChestObject::AChestObject(const sf::Vector2f& StartPositionChest)
     : bIsChestOpen(false),
-      ChestID(EChestType::ECT_Non),
-      CurrentChestAnimation(nullptr)
+      ChestID(EChestType::ECT_Non)
 {
     ActorSize = {16.f, 13.f};
 
@@ -40,19 +39,15 @@ void AChestObject::InitChest(ASpriteManager& SpriteManager)
             AActor::InitActorTexture(ChestTexturePath, RedChestRectTexture, ActorSize, ChestOrigin, SpriteManager);
 
             // Анимация открытия сундука
-            RedChestOpenAnimation.AnimTexture.loadFromFile(ChestTexturePath);
-            RedChestOpenAnimation.FrameSpeed = 5.f;
-            RedChestOpenAnimation.FrameRect.emplace_back(sf::IntRect(RedChestRectTexture));
-            RedChestOpenAnimation.FrameRect.emplace_back(
-                sf::IntRect(16, 1, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-            RedChestOpenAnimation.FrameRect.emplace_back(
-                sf::IntRect(48, 1, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-            RedChestOpenAnimation.FrameRect.emplace_back(
-                sf::IntRect(64, 1, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
+            ChestOpenAnimation.SetAnimationClip(SpriteManager.LoadAnimationClip("Chest_RedOpen", ChestTexturePath,
+                {
+                    sf::IntRect(RedChestRectTexture),
+                    sf::IntRect(16, 1, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)),
+                    sf::IntRect(48, 1, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)),
+                    sf::IntRect(64, 1, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y))
+                }, 5.f));
 
-            RedChestOpenAnimation.SetStopAtLastFrame(true); // Остановить на последнем кадре
-
-            CurrentChestAnimation = &RedChestOpenAnimation; // Назначаем текущую анимацию
+            ChestOpenAnimation.SetStopAtLastFrame(true); // Остановить на последнем кадре
 
             ChestID = EChestType::ECT_Red;
 
@@ -65,19 +60,15 @@ void AChestObject::InitChest(ASpriteManager& SpriteManager)
             AActor::InitActorTexture(ChestTexturePath, GreenChestRectTexture, ActorSize, ChestOrigin, SpriteManager);
 
             // Анимация открытия сундука
-            GreenChestOpenAnimation.AnimTexture.loadFromFile(ChestTexturePath);
-            GreenChestOpenAnimation.FrameSpeed = 5.f;
-            GreenChestOpenAnimation.FrameRect.emplace_back(sf::IntRect(GreenChestRectTexture));
-            GreenChestOpenAnimation.FrameRect.emplace_back(
-                sf::IntRect(16, 16, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-            GreenChestOpenAnimation.FrameRect.emplace_back(
-                sf::IntRect(48, 16, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-            GreenChestOpenAnimation.FrameRect.emplace_back(
-                sf::IntRect(64, 16, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-
-            GreenChestOpenAnimation.SetStopAtLastFrame(true); // Остановить на последнем кадре
+            ChestOpenAnimation.SetAnimationClip(SpriteManager.LoadAnimationClip("Chest_GreenOpen", ChestTexturePath,
+                {
+                    sf::IntRect(GreenChestRectTexture),
+                    sf::IntRect(16, 16, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)),
+                    sf::IntRect(48, 16, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)),
+                    sf::IntRect(64, 16, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y))
+                }, 5.f));
 
-            CurrentChestAnimation = &GreenChestOpenAnimation; // Назначаем текущую анимацию
+            ChestOpenAnimation.SetStopAtLastFrame(true); // Остановить на последнем кадре
 
             ChestID = EChestType::ECT_Green;
 
@@ -90,19 +81,15 @@ void AChestObject::InitChest(ASpriteManager& SpriteManager)
             AActor::InitActorTexture(ChestTexturePath, YellowChestRectTexture, ActorSize, ChestOrigin, SpriteManager);
 
             // Анимация открытия сундука
-            YellowChestOpenAnimation.AnimTexture.loadFromFile(ChestTexturePath);
-            YellowChestOpenAnimation.FrameSpeed = 3.f;
-            YellowChestOpenAnimation.FrameRect.emplace_back(sf::IntRect(YellowChestRectTexture));
-            YellowChestOpenAnimation.FrameRect.emplace_back(
-                sf::IntRect(16, 31, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-            YellowChestOpenAnimation.FrameRect.emplace_back(
-                sf::IntRect(48, 31, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-            YellowChestOpenAnimation.FrameRect.emplace_back(
-                sf::IntRect(64, 31, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)));
-
-            YellowChestOpenAnimation.SetStopAtLastFrame(true); // Остановить на последнем кадре
+            ChestOpenAnimation.SetAnimationClip(SpriteManager.LoadAnimationClip("Chest_YellowOpen", ChestTexturePath,
+                {
+                    sf::IntRect(YellowChestRectTexture),
+                    sf::IntRect(16, 31, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)),
+                    sf::IntRect(48, 31, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)),
+                    sf::IntRect(64, 31, static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y))
+                }, 3.f));
 
-            CurrentChestAnimation = &YellowChestOpenAnimation; // Назначаем текущую анимацию
+            ChestOpenAnimation.SetStopAtLastFrame(true); // Остановить на последнем кадре
 
             ChestID = EChestType::ECT_Yellow;
 
@@ -125,12 +112,12 @@ void AChestObject::InitChest(ASpriteManager& SpriteManager)
 */
 void AChestObject::ChestUpdateAnimation(float DeltaTime)
 {
-    if (bIsChestOpen && CurrentChestAnimation)
+    if (bIsChestOpen && ChestOpenAnimation.GetAnimationClip())
     {
-        if (!CurrentChestAnimation->IsAnimationFinished())
+        if (!ChestOpenAnimation.IsAnimationFinished())
         {
-            ActorSprite.setTextureRect(CurrentChestAnimation->GetCurrentFrame());
-            CurrentChestAnimation->AnimationUpdate(DeltaTime);
+            ActorSprite.setTextureRect(ChestOpenAnimation.GetCurrentFrame());
+            ChestOpenAnimation.AnimationUpdate(DeltaTime);
         }
     }
 
@@ -160,20 +147,23 @@ void AChestObject::IncreaseOpenChestCounter()
 }
 
 /**
-* @brief Сбрасывает состояние сундука.
+* @brief Возвращает сундук в закрытое состояние.
+* 
+* Цвет сундука и клип анимации открытия сохраняются, поэтому сундук не нужно создавать заново.
 */
-void AChestObject::ResetChestObject()
+void AChestObject::CloseChest()
 {
-    ChestCount = 1;
     ChestOpenCountStatic = 0;
 
     bIsChestOpen = false;
-    ChestID = EChestType::ECT_Non;
-    CurrentChestAnimation = nullptr;
+    ChestOpenAnimation.ResetAnimation();
+    ChestOpenAnimation.SetStopAtLastFrame(true); // Остановить на последнем кадре
 
-    RedChestOpenAnimation.ResetAnimation();
-    GreenChestOpenAnimation.ResetAnimation();
-    YellowChestOpenAnimation.ResetAnimation();
+    // Первый кадр анимации открытия совпадает с закрытым сундуком
+    if (ChestOpenAnimation.GetAnimationClip())
+    {
+        ActorSprite.setTextureRect(ChestOpenAnimation.GetCurrentFrame());
+    }
 }
 
 /**
@@ -60,9 +60,11 @@ public:
     void IncreaseOpenChestCounter();
 
     /**
-     * @brief Сбрасывает состояние сундука.
+     * @brief Возвращает сундук в закрытое состояние.
+     * 
+     * Цвет сундука и клип анимации открытия сохраняются, поэтому сундук не нужно создавать заново.
      */
-    void ResetChestObject();
+    void CloseChest();
 
     /**
      * @brief Отрисовывает сундук.
@@ -97,9 +99,5 @@ public:
 private:
     EChestType ChestID;                            // Идентификатор типа сундука
 
-    AAnimationManager RedChestOpenAnimation;       // Анимация открытия красного сундука
-    AAnimationManager GreenChestOpenAnimation;     // Анимация открытия зеленого сундука
-    AAnimationManager YellowChestOpenAnimation;    // Анимация открытия желтого сундука
-    
-    AAnimationManager* CurrentChestAnimation;      // Указатель на текущую анимацию сундука
+    AAnimationManager ChestOpenAnimation;          // Анимация открытия сундука, клип зависит от цвета сундука
 };
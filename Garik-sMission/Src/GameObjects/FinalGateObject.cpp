@@ -1,4 +1,5 @@
 #include "FinalGateObject.h"
+#include "../GameMap/GameMap.h"
 
 
 /**
@@ -11,6 +12,7 @@ AFinalGateObject::AFinalGateObject(sf::Vector2f& StartPosition)
     ActorSize = {6.f, 64.f};
 
     ActorCollisionRect = {StartPosition.x, StartPosition.y, ActorSize.x, ActorSize.y};
+    ClosedGateCollisionRect = ActorCollisionRect;
 }
 
 /**
@@ -27,31 +29,32 @@ void AFinalGateObject::InitFinalGate(ASpriteManager& SpriteManager)
     const sf::Vector2f GateOrigin = {0.5f, 0.5f};
 
     AActor::InitActorTexture(GateTexturePath, CloseGateRectTexture, ActorSize, GateOrigin, SpriteManager);
+    GateSheetOffset = SpriteManager.GetTextureRegion(GateTexturePath).getPosition();
 
-    // Установка позиции спрайта закрытых ворот
-    ActorDrawPosition = {
-        ActorCollisionRect.left + (ActorSize.x / 2.f),
-        ActorCollisionRect.top + (ActorSize.y / 2.f)
-    };
-
-    ActorSprite.setPosition(ActorDrawPosition);
-    ActorSprite.setScale(2.f, 1.45f);
+    ResetFinalGate();
 }
 
 /**
 * @brief Обновление состояния финальных ворот.
 * 
-* Обрабатывает изменения состояния ворот (например, открытие/закрытие).
+* Обрабатывает изменения состояния ворот (например, открытие/закрытие)
+* и выключает динамическое препятствие ворот на карте.
+* 
+* @param GameMap Игровая карта со слоем динамических препятствий.
 */
-void AFinalGateObject::UpdateStateFinalGate()
-{    
+void AFinalGateObject::UpdateStateFinalGate(AGameMap& GameMap)
+{
+    // Выключаем коллизию ворот, чтобы персонаж мог пройти
+    ADynamicObstacleLayer& DynamicObstacleLayer = GameMap.GetDynamicObstacleLayer();
+    DynamicObstacleLayer.SetObstacleEnabled(DynamicObstacleLayer.FindObstacleID("FinalGate"), false);
+
     // Установка позиции спрайта открытых ворот
     ActorSize = {32.f, 48.f};
     sf::Vector2f OpenGatePosition = {5048.f, 521.f};
     
     ActorCollisionRect = {OpenGatePosition, ActorSize};
-    sf::IntRect OpenGateRectTexture = {160, 288, static_cast<int>(ActorSize.x),
-                                                 static_cast<int>(ActorSize.y)};
+    sf::IntRect OpenGateRectTexture = {GateSheetOffset.x + 160, GateSheetOffset.y + 288, static_cast<int>(ActorSize.x),
+                                                                                         static_cast<int>(ActorSize.y)};
 
     ActorSprite.setTextureRect(OpenGateRectTexture);
     ActorSprite.setScale(2.f, 1.94f);
@@ -64,6 +67,30 @@ void AFinalGateObject::UpdateStateFinalGate()
     ActorSprite.setPosition(ActorDrawPosition);
 }
 
+/**
+* @brief Возвращает ворота в закрытое состояние.
+* 
+* Динамическое препятствие ворот на карте восстанавливается вместе со снимком мира.
+*/
+void AFinalGateObject::ResetFinalGate()
+{
+    ActorSize = {ClosedGateCollisionRect.width, ClosedGateCollisionRect.height};
+    ActorCollisionRect = ClosedGateCollisionRect;
+
+    const sf::IntRect CloseGateRectTexture = {GateSheetOffset.x + 157, GateSheetOffset.y + 480,
+                                              static_cast<int>(ActorSize.x), static_cast<int>(ActorSize.y)};
+    ActorSprite.setTextureRect(CloseGateRectTexture);
+
+    // Установка позиции спрайта закрытых ворот
+    ActorDrawPosition = {
+        ActorCollisionRect.left + (ActorSize.x / 2.f),
+        ActorCollisionRect.top + (ActorSize.y / 2.f)
+    };
+
+    ActorSprite.setPosition(ActorDrawPosition);
+    ActorSprite.setScale(2.f, 1.45f);
+}
+
 /**
 * @brief Отрисовка финальных ворот.
 * 
@@ -3,6 +3,9 @@
 #include "ChestObject.h"
 #include "../Manager/ASoundManager.h"
 
+// Преждевременное объявление(форвард декларейшен)
+class AGameMap;
+
 class AFinalGateObject : public AActor
 {
 public:
@@ -30,9 +33,19 @@ public:
     /**
      * @brief Обновление состояния финальных ворот.
      * 
-     * Обрабатывает изменения состояния ворот (например, открытие/закрытие).
+     * Обрабатывает изменения состояния ворот (например, открытие/закрытие)
+     * и выключает динамическое препятствие ворот на карте.
+     * 
+     * @param GameMap Игровая карта со слоем динамических препятствий.
      */
-    void UpdateStateFinalGate();
+    void UpdateStateFinalGate(AGameMap& GameMap);
+
+    /**
+     * @brief Возвращает ворота в закрытое состояние.
+     * 
+     * Динамическое препятствие ворот на карте восстанавливается вместе со снимком мира.
+     */
+    void ResetFinalGate();
 
     /**
      * @brief Отрисовка финальных ворот.
@@ -40,4 +53,8 @@ public:
      * @param Window Окно, в котором будут отображаться финальные ворота.
      */
     void DrawActor(sf::RenderWindow& Window) override;
+
+private:
+    sf::FloatRect ClosedGateCollisionRect;    // Прямоугольник коллизии закрытых ворот
+    sf::Vector2i GateSheetOffset;             // Смещение листа ворот на текстуре (ненулевое, если лист в атласе)
 };
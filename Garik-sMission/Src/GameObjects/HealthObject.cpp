@@ -84,3 +84,17 @@ void AHealthObject::DrawActor(sf::RenderWindow& Window)
         Window.draw(ActorSprite);
     }
 }
+
+/**
+* @brief Добавляет объект лечения в пакетную отрисовку, съеденный объект не добавляется.
+* 
+* @param SpriteBatch Пакетная отрисовка кадра.
+* @param Layer Слой отрисовки объекта.
+*/
+void AHealthObject::BatchActor(ASpriteBatch& SpriteBatch, ERenderLayer Layer) const
+{
+    if (!bIsEatenHeal)
+    {
+        SpriteBatch.AddSprite(ActorSprite, Layer);
+    }
+}
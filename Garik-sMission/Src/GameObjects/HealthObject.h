@@ -46,6 +46,14 @@ public:
      */
     void DrawActor(sf::RenderWindow& Window) override;
 
+    /**
+     * @brief Добавляет объект лечения в пакетную отрисовку, съеденный объект не добавляется.
+     * 
+     * @param SpriteBatch Пакетная отрисовка кадра.
+     * @param Layer Слой отрисовки объекта.
+     */
+    void BatchActor(ASpriteBatch& SpriteBatch, ERenderLayer Layer) const override;
+
 private:
     bool bIsEatenHeal;               // Флаг, указывает, был ли объект лечения использован
     sf::Vector2f StartPosition;      // Начальная позиция объекта лечения
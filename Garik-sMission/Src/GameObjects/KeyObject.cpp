@@ -197,20 +197,6 @@ void AKeyObject::MakrKeyInTopRightCorner(const sf::View& Window)
     AKeyObject::SetActorPosition(NewPosition);
 }
 
-/**
- * @brief Сброс состояния ключа.
- * 
- * Сбрасывает все параметры ключа к начальному состоянию.
- */
-void AKeyObject::ResetKey()
-{
-    // Устанавливаем дефолтные значения ключа
-    KeysCount = 0;
-    KeysCountFound = 0;
-
-    KeyID = EKeyType::EKT_Non;
-}
-
 /**
  * @brief Отрисовка ключа на экране.
  * 
@@ -75,13 +75,6 @@ public:
      */
     void MakrKeyInTopRightCorner(const sf::View& Window);
 
-    /**
-     * @brief Сброс состояния ключа.
-     * 
-     * Сбрасывает все параметры ключа к начальному состоянию.
-     */
-    void ResetKey();
-
     /**
      * @brief Отрисовка ключа на экране.
      * 
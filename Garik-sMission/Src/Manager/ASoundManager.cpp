@@ -12,15 +12,24 @@ ASoundManager::ASoundManager()
       MasterVolumeLevel(100.f),
       PreviousMasterVolume(0.f),
       BackgroundVolume(0.f),
-      HelicopterVolume(0.f)
+      HelicopterVolume(0.f),
+      bIsTransitionVolumeSaved(false),
+      SavedBackgroundVolume(100.f),
+      SavedHelicopterVolume(100.f),
+      FrameCounter(0),
+      VoiceStartCounter(0)
 {
+    VoicePool.resize(SOUND_VOICE_POOL_CAPACITY);
 }
 
 ASoundManager::~ASoundManager()
 {
+    // Голоса освобождаются раньше буферов, на которые они ссылаются
+    VoicePool.clear();
+    SoundEffects.clear();
     IndividualVolumeLevel.clear();
     SoundBuffers.clear();
-    Sounds.clear();
+    MusicTracks.clear();
 }
 
 /**
@@ -30,28 +39,39 @@ ASoundManager::~ASoundManager()
 */
 void ASoundManager::InitSoundGame()
 {
-    // Загрузка фоновой музыки
-    LoadSound("BackgroundMusic", ASSETS_PATH + "Sounds/Background.mp3"); // Фоновая музыка во время игры
-    LoadSound("MenuMusic", ASSETS_PATH + "Sounds/MenuMusic.mp3"); // Фоновая музыка в меню
-
-    // Загружаем звуки и добавляем их в контейнеры
-    LoadSound("PlayerDamage", ASSETS_PATH + "Sounds/PlayerDamage.mp3"); // Звук, когда персонаж получает урон
-    LoadSound("PlayerDeath", ASSETS_PATH + "Sounds/PlayerDeath.mp3"); // Звук смерти персонажа
-    LoadSound("PlayerShot", ASSETS_PATH + "Sounds/Shot.mp3"); // Звук выстрела
-    LoadSound("EnemyDeath", ASSETS_PATH + "Sounds/EnemyDeath.mp3"); // Звук смерти врагов
-    LoadSound("KeyFound", ASSETS_PATH + "Sounds/KeyFound.mp3"); // Звук, когда персонаж подобрал ключ
-    LoadSound("OpenChest", ASSETS_PATH + "Sounds/OpenChest.mp3"); // Звук открытия сундука
-    LoadSound("EatenHeal", ASSETS_PATH + "Sounds/EatenHeal.mp3"); // Звук съедания лечения
-    LoadSound("Lava", ASSETS_PATH + "Sounds/LavaDamage.mp3"); // Звук бурлящей лавы
-    LoadSound("Peaks", ASSETS_PATH + "Sounds/PeaksDamage.mp3"); // Звук пронзающих пик персонажа
-    LoadSound("ClickButton", ASSETS_PATH + "Sounds/ClickButton.mp3"); // Звук клика по кнопки
-    LoadSound("DialogueDevice", ASSETS_PATH + "Sounds/DialogueDevice.mp3"); // Звук старого работающего устройства
-    LoadSound("OffDialogueDevice", ASSETS_PATH + "Sounds/OffDialogueDevice.mp3"); // Звук выключение старого устройства
-    LoadSound("Helicopter", ASSETS_PATH + "Sounds/Helicopter.mp3"); // Звук верталёта
-    LoadSound("SMSDialogue", ASSETS_PATH + "Sounds/SMS8bit.mp3"); // Звук короткого пика, как на старых устройствах
-    LoadSound("OpenGate", ASSETS_PATH + "Sounds/OpenGate.mp3"); // Звук открытия ворот
-    LoadSound("BulletHit", ASSETS_PATH + "Sounds/BulletHit.mp3"); // Звук попадения пули по врагу
-    LoadSound("RocketExplosion", ASSETS_PATH + "Sounds/RocketExplosion.mp3"); // Звук попадения рокеты(дитонация)
+    // Фоновая музыка и зацикленные звуки проигрываются потоком, у каждого свой источник
+    LoadMusic("BackgroundMusic", ASSETS_PATH + "Sounds/Background.mp3"); // Фоновая музыка во время игры
+    LoadMusic("MenuMusic", ASSETS_PATH + "Sounds/MenuMusic.mp3"); // Фоновая музыка в меню
+    LoadMusic("Helicopter", ASSETS_PATH + "Sounds/Helicopter.mp3"); // Звук верталёта
+
+    // Загружаем звуковые эффекты, они проигрываются голосами общего пула
+    using enum ESoundPriority;
+    LoadSoundEffect("PlayerDamage", ASSETS_PATH + "Sounds/PlayerDamage.mp3", 2, ESP_High); // Звук, когда персонаж получает урон
+    LoadSoundEffect("PlayerDeath", ASSETS_PATH + "Sounds/PlayerDeath.mp3", 1, ESP_Critical); // Звук смерти персонажа
+    LoadSoundEffect("PlayerShot", ASSETS_PATH + "Sounds/Shot.mp3", 4, ESP_Normal); // Звук выстрела
+    LoadSoundEffect("EnemyDeath", ASSETS_PATH + "Sounds/EnemyDeath.mp3", 3, ESP_Normal); // Звук смерти врагов
+    LoadSoundEffect("KeyFound", ASSETS_PATH + "Sounds/KeyFound.mp3", 1, ESP_High); // Звук, когда персонаж подобрал ключ
+    LoadSoundEffect("OpenChest", ASSETS_PATH + "Sounds/OpenChest.mp3", 1, ESP_High); // Звук открытия сундука
+    LoadSoundEffect("EatenHeal", ASSETS_PATH + "Sounds/EatenHeal.mp3", 1, ESP_High); // Звук съедания лечения
+    LoadSoundEffect("Lava", ASSETS_PATH + "Sounds/LavaDamage.mp3", 1, ESP_Critical); // Звук бурлящей лавы
+    LoadSoundEffect("Peaks", ASSETS_PATH + "Sounds/PeaksDamage.mp3", 1, ESP_Critical); // Звук пронзающих пик персонажа
+    LoadSoundEffect("ClickButton", ASSETS_PATH + "Sounds/ClickButton.mp3", 2, ESP_High); // Звук клика по кнопки
+    LoadSoundEffect("DialogueDevice", ASSETS_PATH + "Sounds/DialogueDevice.mp3", 1, ESP_High); // Звук старого работающего устройства
+    LoadSoundEffect("OffDialogueDevice", ASSETS_PATH + "Sounds/OffDialogueDevice.mp3", 1, ESP_High); // Звук выключение старого устройства
+    LoadSoundEffect("SMSDialogue", ASSETS_PATH + "Sounds/SMS8bit.mp3", 1, ESP_High); // Звук короткого пика, как на старых устройствах
+    LoadSoundEffect("OpenGate", ASSETS_PATH + "Sounds/OpenGate.mp3", 1, ESP_Critical); // Звук открытия ворот
+    LoadSoundEffect("BulletHit", ASSETS_PATH + "Sounds/BulletHit.mp3", 4, ESP_Low); // Звук попадения пули по врагу
+    LoadSoundEffect("RocketExplosion", ASSETS_PATH + "Sounds/RocketExplosion.mp3", 3, ESP_Normal); // Звук попадения рокеты(дитонация)
+}
+
+/**
+* @brief Обновляет менеджер звуков, вызывается один раз за кадр.
+* 
+* Начинает новый кадр, одинаковые запуски эффекта внутри кадра объединяются в один.
+*/
+void ASoundManager::UpdateSoundManager()
+{
+    ++FrameCounter;
 }
 
 /**
@@ -63,11 +83,18 @@ void ASoundManager::SetMasterVolume(float Volume)
 {
     // Устанавливаем общий уровень громкости для всех звуков
     MasterVolumeLevel = Volume;
-    for (auto& Val : Sounds | std::views::values)
+    for (auto& Val : MusicTracks | std::views::values)
     {
         float IndividualVolume = IndividualVolumeLevel[&Val];
         Val.setVolume(IndividualVolume * MasterVolumeLevel / 100.f);
     }
+    for (SoundVoice& Voice : VoicePool)
+    {
+        if (Voice.Effect)
+        {
+            Voice.Sound.setVolume(Voice.Effect->Volume * MasterVolumeLevel / 100.f);
+        }
+    }
     PreviousMasterVolume = Volume;
 }
 
@@ -78,6 +105,16 @@ void ASoundManager::SetMasterVolume(float Volume)
 */
 void ASoundManager::SmoothTransition()
 {
+    // Запоминаем громкости, выставленные в меню, чтобы вернуть их при перезапуске
+    if (!bIsTransitionVolumeSaved)
+    {
+        auto BackgroundIt = IndividualVolumeLevel.find(&GetMusic("BackgroundMusic"));
+        auto HelicopterIt = IndividualVolumeLevel.find(&GetMusic("Helicopter"));
+        SavedBackgroundVolume = BackgroundIt != IndividualVolumeLevel.end() ? BackgroundIt->second : 100.f;
+        SavedHelicopterVolume = HelicopterIt != IndividualVolumeLevel.end() ? HelicopterIt->second : 100.f;
+        bIsTransitionVolumeSaved = true;
+    }
+
     // Увеличиваем громкость вертолета
     if (isHelicopterStarted)
     {
@@ -101,7 +138,7 @@ void ASoundManager::SmoothTransition()
 
     if (!isHelicopterStarted)
     {
-        BackgroundVolume = GetSound("BackgroundMusic").getVolume();
+        BackgroundVolume = GetMusic("BackgroundMusic").getVolume();
     }
 
     // Уменьшаем громкость фоновой музыки
@@ -121,16 +158,45 @@ void ASoundManager::SmoothTransition()
 }
 
 /**
-* @brief Получает ссылку на звук по его имени.
+* @brief Возвращает звуки в состояние начала игры.
+* 
+* Останавливает все звуки и отменяет плавный переход, загруженные буферы сохраняются.
+*/
+void ASoundManager::ResetSoundState()
+{
+    for (auto& Val : MusicTracks | std::views::values)
+    {
+        Val.stop();
+    }
+    for (SoundVoice& Voice : VoicePool)
+    {
+        Voice.Sound.stop();
+        Voice.Effect = nullptr;
+    }
+
+    if (bIsTransitionVolumeSaved)
+    {
+        SetVolume("BackgroundMusic", SavedBackgroundVolume);
+        SetVolume("Helicopter", SavedHelicopterVolume);
+        bIsTransitionVolumeSaved = false;
+    }
+
+    isHelicopterStarted = false;
+    BackgroundVolume = 0.f;
+    HelicopterVolume = 0.f;
+}
+
+/**
+* @brief Получает ссылку на потоковую музыку по её имени.
 * 
 * @param SoundName Имя звука.
 * 
-* @return sf::Sound& Ссылка на объект звука.
+* @return sf::Music& Ссылка на объект музыки.
 */
-sf::Sound& ASoundManager::GetSound(const std::string& SoundName)
+sf::Music& ASoundManager::GetMusic(const std::string& SoundName)
 {
-    auto It = Sounds.find(SoundName);
-    if (It != Sounds.end())
+    auto It = MusicTracks.find(SoundName);
+    if (It != MusicTracks.end())
     {
         return It->second;
     }
@@ -140,63 +206,186 @@ sf::Sound& ASoundManager::GetSound(const std::string& SoundName)
 /**
 * @brief Устанавливает уровень громкости для конкретного звука.
 * 
+* Для звукового эффекта громкость применяется и к уже звучащим экземплярам.
+* 
 * @param SoundName Имя звука.
 * @param Volume Уровень громкости (от 0.0 до 50.0).
-* 
-* @return sf::Sound const& Константная ссылка на объект звука.
 */
-sf::Sound const& ASoundManager::SetVolume(const std::string& SoundName, float Volume)
+void ASoundManager::SetVolume(const std::string& SoundName, float Volume)
 {
-    auto It = Sounds.find(SoundName);
-    if (It != Sounds.end())
+    auto It = MusicTracks.find(SoundName);
+    if (It != MusicTracks.end())
     {
         IndividualVolumeLevel[&It->second] = Volume; // Сохраняем индивидуальный уровень громкости
         It->second.setVolume(Volume * MasterVolumeLevel / 100.f); // Применяем громкость с учётом MasterVolume
-        return It->second;
+        return;
+    }
+
+    auto EffectIt = SoundEffects.find(SoundName);
+    if (EffectIt != SoundEffects.end())
+    {
+        EffectIt->second.Volume = Volume;
+        for (SoundVoice& Voice : VoicePool)
+        {
+            if (Voice.Effect == &EffectIt->second)
+            {
+                Voice.Sound.setVolume(Volume * MasterVolumeLevel / 100.f);
+            }
+        }
+        return;
     }
     throw std::runtime_error("Sound not found: " + SoundName);
 }
 
 /**
-* @brief Загружает звук и добавляет его в контейнер.
+* @brief Загружает буфер звука в контейнер буферов.
 * 
 * @param SoundName Имя звука.
 * @param FilePath Путь к файлу со звуком.
+* 
+* @return Ссылка на загруженный буфер.
 */
-void ASoundManager::LoadSound(const std::string& SoundName, const std::string& FilePath)
+sf::SoundBuffer& ASoundManager::LoadSoundBuffer(const std::string& SoundName, const std::string& FilePath)
 {
     sf::SoundBuffer Buffer;
     if (!Buffer.loadFromFile(FilePath))
     {
-        throw std::runtime_error("Error: Failed to load texture: " + ASSETS_PATH + FilePath);
+        throw std::runtime_error("Error: Failed to load sound: " + FilePath);
     }
 
     // Сохраняем буфер в контейнер
     SoundBuffers[SoundName] = std::move(Buffer);
+    return SoundBuffers[SoundName];
+}
+
+/**
+* @brief Открывает потоковую музыку (музыка, зацикленные звуки) и добавляет её в контейнер.
+* 
+* Файл только открывается, звук декодируется по частям во время воспроизведения.
+* 
+* @param SoundName Имя звука.
+* @param FilePath Путь к файлу со звуком.
+*/
+void ASoundManager::LoadMusic(const std::string& SoundName, const std::string& FilePath)
+{
+    // sf::Music нельзя копировать и перемещать, поэтому она создаётся прямо в контейнере
+    sf::Music& Music = MusicTracks[SoundName];
+    if (!Music.openFromFile(FilePath))
+    {
+        MusicTracks.erase(SoundName);
+        throw std::runtime_error("Error: Failed to open music: " + FilePath);
+    }
+}
 
-    sf::Sound Sound;
+/**
+* @brief Загружает звуковой эффект, который проигрывается голосами общего пула.
+* 
+* @param SoundName Имя звука.
+* @param FilePath Путь к файлу со звуком.
+* @param MaxInstances Наибольшее количество одновременно звучащих экземпляров.
+* @param Priority Приоритет эффекта при нехватке голосов.
+*/
+void ASoundManager::LoadSoundEffect(const std::string& SoundName, const std::string& FilePath,
+                                    int MaxInstances, ESoundPriority Priority)
+{
+    SoundEffect& Effect = SoundEffects[SoundName];
+    Effect.Buffer = &LoadSoundBuffer(SoundName, FilePath);
+    Effect.MaxInstances = MaxInstances;
+    Effect.Priority = Priority;
+}
+
+/**
+* @brief Запускает экземпляр звукового эффекта на свободном или отнятом голосе.
+* 
+* @param Effect Звуковой эффект.
+*/
+void ASoundManager::PlaySoundEffect(SoundEffect& Effect)
+{
+    // Одинаковые запуски в одном кадре (например, несколько попаданий сразу) звучат как один
+    if (Effect.LastPlayFrame == FrameCounter)
+    {
+        return;
+    }
+    Effect.LastPlayFrame = FrameCounter;
+
+    int ActiveInstances = 0;
+    SoundVoice* FreeVoice = nullptr;
+    SoundVoice* StealVoice = nullptr;
 
-    // Привязываем буфер к объекту sf::Sound
-    Sound.setBuffer(SoundBuffers[SoundName]);
+    for (SoundVoice& Voice : VoicePool)
+    {
+        if (Voice.Sound.getStatus() == sf::SoundSource::Stopped)
+        {
+            // Голос доиграл, он свободен
+            Voice.Effect = nullptr;
+            if (!FreeVoice)
+            {
+                FreeVoice = &Voice;
+            }
+            continue;
+        }
 
-    // Сохраняем звук в контейнер
-    Sounds[SoundName] = std::move(Sound);
+        if (Voice.Effect == &Effect)
+        {
+            ++ActiveInstances;
+        }
+
+        // Кандидат на отнятие: самый низкий приоритет, среди равных самый старый
+        if (!StealVoice
+            || Voice.Effect->Priority < StealVoice->Effect->Priority
+            || (Voice.Effect->Priority == StealVoice->Effect->Priority && Voice.StartOrder < StealVoice->StartOrder))
+        {
+            StealVoice = &Voice;
+        }
+    }
+
+    // Эффект уже звучит максимальное количество раз
+    if (ActiveInstances >= Effect.MaxInstances)
+    {
+        return;
+    }
+
+    SoundVoice* Voice = FreeVoice;
+    if (!Voice)
+    {
+        // Все голоса заняты, отнимаем голос только у эффекта с приоритетом не выше нового
+        if (!StealVoice || StealVoice->Effect->Priority > Effect.Priority)
+        {
+            return;
+        }
+        Voice = StealVoice;
+        Voice->Sound.stop();
+    }
+
+    Voice->Effect = &Effect;
+    Voice->StartOrder = ++VoiceStartCounter;
+    Voice->Sound.setBuffer(*Effect.Buffer);
+    Voice->Sound.setVolume(Effect.Volume * MasterVolumeLevel / 100.f);
+    Voice->Sound.play();
 }
 
 /**
 * @brief Воспроизводит звук по его имени.
 * 
-* @param SoundName Имя звука.
+* Звуковой эффект не прерывает свои уже звучащие экземпляры. Запуск пропускается, если эффект уже
+* запускался в этом кадре, достиг своего предела экземпляров или все голоса заняты эффектами с более высоким приоритетом.
 * 
-* @return sf::Sound const& Константная ссылка на объект звука.
+* @param SoundName Имя звука.
 */
-sf::Sound const& ASoundManager::PlaySound(const std::string& SoundName)
+void ASoundManager::PlaySound(const std::string& SoundName)
 {
-    auto It = Sounds.find(SoundName);
-    if (It != Sounds.end())
+    auto It = MusicTracks.find(SoundName);
+    if (It != MusicTracks.end())
     {
         It->second.play();
-        return It->second;
+        return;
+    }
+
+    auto EffectIt = SoundEffects.find(SoundName);
+    if (EffectIt != SoundEffects.end())
+    {
+        PlaySoundEffect(EffectIt->second);
+        return;
     }
     throw std::runtime_error("Sound not found: " + SoundName);
 }
@@ -204,17 +393,31 @@ sf::Sound const& ASoundManager::PlaySound(const std::string& SoundName)
 /**
 * @brief Останавливает воспроизведение звука по его имени.
 * 
-* @param SoundName Имя звука.
+* Для звукового эффекта останавливаются все его экземпляры.
 * 
-* @return sf::Sound const& Константная ссылка на объект звука.
+* @param SoundName Имя звука.
 */
-sf::Sound const& ASoundManager::StopSound(const std::string& SoundName)
+void ASoundManager::StopSound(const std::string& SoundName)
 {
-    auto It = Sounds.find(SoundName);
-    if (It != Sounds.end())
+    auto It = MusicTracks.find(SoundName);
+    if (It != MusicTracks.end())
     {
         It->second.stop();
-        return It->second;
+        return;
+    }
+
+    auto EffectIt = SoundEffects.find(SoundName);
+    if (EffectIt != SoundEffects.end())
+    {
+        for (SoundVoice& Voice : VoicePool)
+        {
+            if (Voice.Effect == &EffectIt->second)
+            {
+                Voice.Sound.stop();
+                Voice.Effect = nullptr;
+            }
+        }
+        return;
     }
     throw std::runtime_error("Sound not found: " + SoundName);
 }
@@ -2,11 +2,46 @@
 #include "../Constants.h"
 #include <unordered_map>
 
+/**
+ * @brief Приоритет звукового эффекта при нехватке голосов.
+ */
+enum class ESoundPriority
+{
+    ESP_Low,        // Частые второстепенные звуки, отдаются первыми
+    ESP_Normal,     // Обычные игровые звуки
+    ESP_High,       // Важные звуки игрока и интерфейса
+    ESP_Critical    // Звуки событий, которые нельзя пропустить
+};
+
+/**
+ * @brief Звуковой эффект, который воспроизводится голосами общего пула.
+ */
+struct SoundEffect
+{
+    const sf::SoundBuffer* Buffer = nullptr;            // Буфер звука
+    float Volume = 100.f;                               // Индивидуальный уровень громкости
+    int MaxInstances = 1;                               // Наибольшее количество одновременно звучащих экземпляров
+    ESoundPriority Priority = ESoundPriority::ESP_Normal; // Приоритет при нехватке голосов
+    uint64_t LastPlayFrame = UINT64_MAX;                // Кадр, в котором эффект запускался последний раз
+};
+
+/**
+ * @brief Голос пула, который проигрывает один экземпляр звукового эффекта.
+ */
+struct SoundVoice
+{
+    sf::Sound Sound;                                    // Источник звука
+    const SoundEffect* Effect = nullptr;                // Эффект, который проигрывает голос
+    uint64_t StartOrder = 0;                            // Порядковый номер запуска, меньше значит старше
+};
+
 /**
  * @brief Управляет звуковыми эффектами в игре.
  * 
- * Класс ASoundManager отвечает за загрузку, воспроизведение и управление звуками, 
+ * Класс ASoundManager отвечает за загрузку, воспроизведение и управление звуками,
  * включая плавные переходы громкости и установку уровня громкости.
+ * Музыка и зацикленные звуки читаются из файла потоком по частям в аудиопотоке SFML и не хранятся в памяти целиком,
+ * а короткие эффекты проигрываются голосами общего пула фиксированного размера, поэтому количество источников OpenAL ограничено.
  */
 class ASoundManager
 {
@@ -34,14 +69,51 @@ public:
 
 private:
     /**
-     * @brief Загружает звук и добавляет его в контейнер.
+     * @brief Загружает буфер звука в контейнер буферов.
      * 
      * @param SoundName Имя звука.
      * @param FilePath Путь к файлу со звуком.
+     * 
+     * @return Ссылка на загруженный буфер.
      */
-    void LoadSound(const std::string& SoundName, const std::string& FilePath);
+    sf::SoundBuffer& LoadSoundBuffer(const std::string& SoundName, const std::string& FilePath);
+
+    /**
+     * @brief Открывает потоковую музыку (музыка, зацикленные звуки) и добавляет её в контейнер.
+     * 
+     * Файл только открывается, звук декодируется по частям во время воспроизведения.
+     * 
+     * @param SoundName Имя звука.
+     * @param FilePath Путь к файлу со звуком.
+     */
+    void LoadMusic(const std::string& SoundName, const std::string& FilePath);
+
+    /**
+     * @brief Загружает звуковой эффект, который проигрывается голосами общего пула.
+     * 
+     * @param SoundName Имя звука.
+     * @param FilePath Путь к файлу со звуком.
+     * @param MaxInstances Наибольшее количество одновременно звучащих экземпляров.
+     * @param Priority Приоритет эффекта при нехватке голосов.
+     */
+    void LoadSoundEffect(const std::string& SoundName, const std::string& FilePath,
+                         int MaxInstances, ESoundPriority Priority);
+
+    /**
+     * @brief Запускает экземпляр звукового эффекта на свободном или отнятом голосе.
+     * 
+     * @param Effect Звуковой эффект.
+     */
+    void PlaySoundEffect(SoundEffect& Effect);
 
 public:
+    /**
+     * @brief Обновляет менеджер звуков, вызывается один раз за кадр.
+     * 
+     * Начинает новый кадр, одинаковые запуски эффекта внутри кадра объединяются в один.
+     */
+    void UpdateSoundManager();
+
     /**
      * @brief Устанавливает уровень громкости для всех звуков.
      * 
@@ -57,41 +129,49 @@ public:
     void SmoothTransition();
 
     /**
-     * @brief Получает ссылку на звук по его имени.
+     * @brief Возвращает звуки в состояние начала игры.
+     * 
+     * Останавливает все звуки и отменяет плавный переход, загруженные буферы сохраняются.
+     */
+    void ResetSoundState();
+
+    /**
+     * @brief Получает ссылку на потоковую музыку по её имени.
      * 
      * @param SoundName Имя звука.
      * 
-     * @return sf::Sound& Ссылка на объект звука.
+     * @return sf::Music& Ссылка на объект музыки.
      */
-    sf::Sound& GetSound(const std::string& SoundName);
+    sf::Music& GetMusic(const std::string& SoundName);
 
     /**
      * @brief Устанавливает уровень громкости для конкретного звука.
      * 
+     * Для звукового эффекта громкость применяется и к уже звучащим экземплярам.
+     * 
      * @param SoundName Имя звука.
      * @param Volume Уровень громкости (от 0.0 до 50.0).
-     * 
-     * @return sf::Sound const& Константная ссылка на объект звука.
      */
-    sf::Sound const& SetVolume(const std::string& SoundName, float Volume);
+    void SetVolume(const std::string& SoundName, float Volume);
 
     /**
      * @brief Воспроизводит звук по его имени.
      * 
-     * @param SoundName Имя звука.
+     * Звуковой эффект не прерывает свои уже звучащие экземпляры. Запуск пропускается, если эффект уже
+     * запускался в этом кадре, достиг своего предела экземпляров или все голоса заняты эффектами с более высоким приоритетом.
      * 
-     * @return sf::Sound const& Константная ссылка на объект звука.
+     * @param SoundName Имя звука.
      */
-    sf::Sound const& PlaySound(const std::string& SoundName);
+    void PlaySound(const std::string& SoundName);
 
     /**
      * @brief Останавливает воспроизведение звука по его имени.
      * 
-     * @param SoundName Имя звука.
+     * Для звукового эффекта останавливаются все его экземпляры.
      * 
-     * @return sf::Sound const& Константная ссылка на объект звука.
+     * @param SoundName Имя звука.
      */
-    sf::Sound const& StopSound(const std::string& SoundName);
+    void StopSound(const std::string& SoundName);
 
 private:
     bool isHelicopterStarted;                                       // Флаг, указывающий, начался ли звук вертолета
@@ -99,10 +179,19 @@ private:
     float PreviousMasterVolume;                                     // Предыдущий уровень громкости
     float BackgroundVolume;                                         // Уровень громкости фоновой музыки
     float HelicopterVolume;                                         // Уровень громкости звука вертолета
- 
-    std::unordered_map<sf::Sound*, float> IndividualVolumeLevel;    // Уровень громкости для каждого звука
-    std::unordered_map<std::string, sf::SoundBuffer> SoundBuffers;  // Буферы звуков
-    std::unordered_map<std::string, sf::Sound> Sounds;              // Звуковые объекты
- 
+
+    bool bIsTransitionVolumeSaved;                                  // Флаг, сохранены ли громкости до плавного перехода
+    float SavedBackgroundVolume;                                    // Громкость фоновой музыки до плавного перехода
+    float SavedHelicopterVolume;                                    // Громкость звука вертолета до плавного перехода
+
+    uint64_t FrameCounter;                                          // Номер текущего кадра для объединения запусков эффектов
+    uint64_t VoiceStartCounter;                                     // Счётчик запусков голосов для выбора самого старого
+
+    std::unordered_map<sf::SoundSource*, float> IndividualVolumeLevel; // Уровень громкости для каждой музыки
+    std::unordered_map<std::string, sf::SoundBuffer> SoundBuffers;  // Буферы звуковых эффектов
+    std::unordered_map<std::string, sf::Music> MusicTracks;         // Потоковая музыка, каждая со своим источником
+    std::unordered_map<std::string, SoundEffect> SoundEffects;      // Звуковые эффекты, проигрываемые голосами пула
+    std::vector<SoundVoice> VoicePool;                              // Голоса, общие для всех звуковых эффектов
+
     sf::Clock TransitionClock;                                      // Часы для отслеживания времени перехода громкости
 };
@@ -3,24 +3,36 @@
 /**
  * @brief Конструктор класса AAnimationManager.
  * 
- * Инициализирует скорость смены кадров и текущий индекс кадра.
+ * Инициализирует текущий индекс кадра, клип не назначен.
  */
 AAnimationManager::AAnimationManager()
-    : bIsAnimationFinished(false),
-      bStopAtLastFrame(false),
-      FrameSpeed(0.f),
-      CurrentFrameIndex(0)
+    : Clip(nullptr),
+      CurrentFrameIndex(0),
+      bIsAnimationFinished(false),
+      bStopAtLastFrame(false)
 {
 }
 
 /**
-* @brief Деструктор по умолчанию.
-* 
-* Освобождает ресурсы, необходимые для управления анимацией.
-*/
-AAnimationManager::~AAnimationManager()
+ * @brief Назначает клип анимации и начинает воспроизведение с первого кадра.
+ * 
+ * @param NewClip Клип анимации из библиотеки менеджера спрайтов.
+ */
+void AAnimationManager::SetAnimationClip(const AnimationClip* NewClip)
+{
+    Clip = NewClip;
+    CurrentFrameIndex = 0;
+    bIsAnimationFinished = false;
+}
+
+/**
+ * @brief Получает клип анимации.
+ * 
+ * @return Указатель на клип анимации или nullptr, если клип не назначен.
+ */
+const AnimationClip* AAnimationManager::GetAnimationClip() const
 {
-    FrameRect.clear();
+    return Clip;
 }
 
 /**
@@ -30,22 +42,22 @@ AAnimationManager::~AAnimationManager()
 */
 void AAnimationManager::AnimationUpdate(float DeltaTime)
 {
-    // Проверяем, если анимация уже завершена, то ничего не делаем
-    if (bIsAnimationFinished)
+    // Проверяем, если анимация уже завершена или клип не назначен, то ничего не делаем
+    if (bIsAnimationFinished || !Clip)
     {
         return;
     }
 
     // Увеличиваем время с учётом скорости анимации
-    CurrentFrameIndex += FrameSpeed * DeltaTime;
+    CurrentFrameIndex += Clip->FrameSpeed * DeltaTime;
 
     // Если текущий индекс превысил количество кадров, начинаем сначала
-    if (CurrentFrameIndex >= FrameRect.size())
+    if (CurrentFrameIndex >= Clip->Frames.size())
     {
         if (bStopAtLastFrame)
         {
             // Устанавливаем индекс на последний кадр
-            CurrentFrameIndex = static_cast<float>(FrameRect.size() - 1);
+            CurrentFrameIndex = static_cast<float>(Clip->Frames.size() - 1);
             bIsAnimationFinished = true;
         }
         else
@@ -78,15 +90,13 @@ void AAnimationManager::SetStopAtLastFrame(bool bStop)
 }
 
 /**
-* @brief Сбрасывает состояние анимации.
+* @brief Сбрасывает состояние воспроизведения анимации, клип остаётся назначенным.
 */
 void AAnimationManager::ResetAnimation()
 {
     bIsAnimationFinished = false;
     bStopAtLastFrame = false;
-    FrameSpeed = 0.f;
     CurrentFrameIndex = 0;
-    FrameRect.clear();
 }
 
 /**
@@ -109,6 +119,26 @@ int AAnimationManager::GetCurrentFrameIndex() const
     return static_cast<int>(CurrentFrameIndex);
 }
 
+/**
+ * @brief Получает количество кадров в клипе анимации.
+ * 
+ * @return Количество кадров, 0 если клип не назначен.
+ */
+size_t AAnimationManager::GetFrameCount() const
+{
+    return Clip ? Clip->Frames.size() : 0;
+}
+
+/**
+ * @brief Получает текстуру клипа анимации.
+ * 
+ * @return Ссылка на общую текстуру клипа.
+ */
+const sf::Texture& AAnimationManager::GetAnimationTexture() const
+{
+    return *Clip->Texture;
+}
+
 /**
  * @brief Получает прямоугольник текущего кадра анимации на текстуре.
  * 
@@ -116,5 +146,5 @@ int AAnimationManager::GetCurrentFrameIndex() const
  */
 sf::IntRect AAnimationManager::GetCurrentFrame() const
 {
-    return FrameRect[static_cast<uint16_t>(CurrentFrameIndex)];
+    return Clip->Frames[static_cast<uint16_t>(CurrentFrameIndex)];
 }
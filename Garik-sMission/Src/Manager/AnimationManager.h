@@ -1,11 +1,13 @@
 #pragma once
 #include "../Constants.h"
+#include "SpriteManager.h"
 
 /**
  * @brief Управляет анимацией объектов в игре.
  * 
- * Класс AAnimationManager управляет последовательным отображением кадров анимации 
- * на основе заданной текстуры и скорости смены кадров.
+ * Класс AAnimationManager хранит только состояние воспроизведения (курсор) общего неизменяемого клипа:
+ * указатель на клип, текущий кадр и флаги. Текстура и кадры лежат в клипе в библиотеке менеджера спрайтов,
+ * поэтому копирование анимации не копирует ни текстуру, ни таблицу кадров.
  */
 class AAnimationManager
 {
@@ -20,9 +22,23 @@ public:
     /**
      * @brief Деструктор по умолчанию.
      * 
-     * Освобождает ресурсы, необходимые для управления анимацией.
+     * Клип принадлежит библиотеке клипов, поэтому освобождать нечего.
      */
-    ~AAnimationManager();
+    ~AAnimationManager() = default;
+
+    /**
+     * @brief Назначает клип анимации и начинает воспроизведение с первого кадра.
+     * 
+     * @param NewClip Клип анимации из библиотеки менеджера спрайтов.
+     */
+    void SetAnimationClip(const AnimationClip* NewClip);
+
+    /**
+     * @brief Получает клип анимации.
+     * 
+     * @return Указатель на клип анимации или nullptr, если клип не назначен.
+     */
+    const AnimationClip* GetAnimationClip() const;
 
     /**
      * @brief Обновляет текущий кадр анимации на основе прошедшего времени.
@@ -46,7 +62,7 @@ public:
     void SetStopAtLastFrame(bool bStop);
 
     /**
-     * @brief Сбрасывает состояние анимации.
+     * @brief Сбрасывает состояние воспроизведения анимации, клип остаётся назначенным.
      */
     void ResetAnimation();
 
@@ -64,6 +80,20 @@ public:
      */
     int GetCurrentFrameIndex() const;
 
+    /**
+     * @brief Получает количество кадров в клипе анимации.
+     * 
+     * @return Количество кадров, 0 если клип не назначен.
+     */
+    size_t GetFrameCount() const;
+
+    /**
+     * @brief Получает текстуру клипа анимации.
+     * 
+     * @return Ссылка на общую текстуру клипа.
+     */
+    const sf::Texture& GetAnimationTexture() const;
+
     /**
      * @brief Получает прямоугольник текущего кадра анимации на текстуре.
      * 
@@ -72,16 +102,8 @@ public:
     sf::IntRect GetCurrentFrame() const;
 
 private:
+    const AnimationClip* Clip;           // Общий неизменяемый клип анимации.
+    float CurrentFrameIndex;             // Текущий индекс кадра анимации в кадрах клипа.
     bool bIsAnimationFinished;           // Флаг завершения анимации
     bool bStopAtLastFrame;               // Флаг для остановки анимации на последнем кадре
-
-public:
-    float FrameSpeed;                    // Скорость смены кадров анимации.
-
-private:
-   float CurrentFrameIndex;              // Текущий индекс кадра анимации в векторе FrameRect.
-
-public:
-    std::vector<sf::IntRect> FrameRect;  // Вектор прямоугольников кадров анимации.
-    sf::Texture AnimTexture;             // Текстура анимации.
 };
@@ -1,5 +1,8 @@
 ﻿// ReSharper disable CppMemberFunctionMayBeStatic
 #include "CollisionManager.h"
+#include <cmath>
+#include <limits>
+#include <numeric>
 
 /**
 * @brief Конструктор класса ACollisionManager.
@@ -21,42 +24,71 @@ ACollisionManager::ACollisionManager(AGameState& GameState, APlayer& Player, AGa
 * @brief Проверяет столкновения всех пуль с врагами и игровой картой.
 * 
 * @param BulletsVectorPtr Указатель на вектор пуль.
-* @param EnemyVectorPtr Указатель на вектор врагов.
-* @param KeysVectorPtr Указатель на вектор ключей.
+* @param EntityStore Хранилище сущностей врагов.
+* @param KeySlotMap Карта слотов, которая владеет ключами, в ней создаются ключи, выпавшие из боссов.
+* @param KeyHandles Дескрипторы ключей, которые ещё не подобраны.
 * @param Player Ссылка на персонажа.
 * @param SpriteManager Ссылка на менеджер спрайтов.
 * @param SoundManager Ссылка на менеджер звуков.
 * @param ParticleSystem Ссылка на менеджер частиц.
 */
 void ACollisionManager::CheckAllBulletCollisions(std::vector<ABullet*>& BulletsVectorPtr,
-                                                 std::vector<AEnemy*>& EnemyVectorPtr,
-                                                 std::vector<AKeyObject*>& KeysVectorPtr,
+                                                 AEntityComponentStore& EntityStore,
+                                                 TSlotMap<AKeyObject>& KeySlotMap,
+                                                 std::vector<EntityHandle>& KeyHandles,
                                                  APlayer& Player,
                                                  ASpriteManager& SpriteManager,
                                                  ASoundManager& SoundManager,
                                                  AParticleSystemManager& ParticleSystem) const
 {
-    // Векторы для хранения пуль и врагов для удаления из основных векторов
-    std::vector<ABullet*> BulletsToRemove;
-    std::vector<APawn*> EnemyToRemove;
+    // Сортируем пули по левой границе, порядок сохраняется между кадрами, поэтому сортировка почти линейная
+    SortActorsByLeftEdge(BulletsVectorPtr);
+
+    // Пули по каналу столкновений, которые летят во врагов, проверяются отдельно широкой фазой
+    EnemyChannelBullets.clear();
+
+    // Получаем границы камеры (вьюпорт)
+    const sf::FloatRect CameraBounds = GetCameraBounds();
 
     for (ABullet* Bullet : BulletsVectorPtr)
     {
-        // Проверяем столкновение с игровой картой и её границами
-        if (CheckBulletCollisionWithGameMap(*Bullet))
+        // Пули, уничтоженные раньше в этом кадре, больше ни с чем не сталкиваются
+        if (Bullet->IsActorPendingDestroy())
+        {
+            continue;
+        }
+
+        // Проверяем, выходит ли пуля за границы видимой области
+        if (!CameraBounds.intersects(Bullet->GetActorCollisionRect()))
         {
             ParticleSystem.PlayEffectWithPosition("BulletDestroy", Bullet->GetActorPosition(), {-4, -4});
-            BulletsToRemove.emplace_back(Bullet);
+            Bullet->MarkActorPendingDestroy();
             continue;
-             
         }
 
-        if (CheckBulletCollisionWithPawn(*Bullet, Player.GetActorCollisionRect()) &&
-            Bullet->GetBulletType() == EBulletType::EBT_ShootAtPlayer)
+        // Проверяем столкновение с игровой картой по всему пути пули за кадр
+        SweepHit GameMapHit;
+        const bool bHitGameMap = SweepBulletAgainstGameMap(*Bullet, GameMapHit);
+
+        // Сначала фильтруем по каналу: пули врагов проверяем только с персонажем, пули персонажа только с врагами
+        if (Bullet->GetBulletType() == EBulletType::EBT_ShootAtEnemy)
         {
-            // Определение направления отталкивания: если пуля находится правее игрока(true),
+            EnemyChannelBullets.push_back({Bullet, bHitGameMap, GameMapHit});
+            continue;
+        }
+
+        // Пуля попадает в персонажа, только если долетела до него раньше, чем до препятствия
+        SweepHit PlayerHit;
+        if (SweepBulletAgainstPawn(*Bullet, Player.GetActorCollisionRect(), PlayerHit) &&
+            (!bHitGameMap || PlayerHit.TimeOfImpact <= GameMapHit.TimeOfImpact))
+        {
+            const sf::Vector2f ImpactPosition = GetBulletImpactPosition(*Bullet, PlayerHit);
+
+            // Определение направления отталкивания: если пуля попала в правую сторону игрока(true),
             // то отталкивание будет влево, иначе вправо
-            bool bFromRight = Bullet->GetActorPosition().x > Player.GetActorPosition().x;
+            bool bFromRight = PlayerHit.Normal.x != 0.f
+                                  ? PlayerHit.Normal.x > 0.f
+                                  : ImpactPosition.x > Player.GetActorPosition().x;
 
             // Воспроизводим анимацию на основе типа уничтожения пули
             switch (Bullet->GetBulletDestroyEffectType())
@@ -66,13 +98,13 @@ void ACollisionManager::CheckAllBulletCollisions(std::vector<ABullet*>& BulletsV
                     // Отталкиваем персонажа и проигрываем анимацию взрыва рокеты
                     Player.OnRocketHit(bFromRight);
                     SoundManager.PlaySound("RocketExplosion");
-                    ParticleSystem.PlayEffectWithPosition("RocketDestroy", Bullet->GetActorPosition(),
+                    ParticleSystem.PlayEffectWithPosition("RocketDestroy", ImpactPosition,
                                                           {-6, -7}, {0.8f, 0.8f});
                     break;
                 }
             default:
                 {
-                    ParticleSystem.PlayEffectWithPosition("BulletDestroy", Bullet->GetActorPosition(), {-4, -4});
+                    ParticleSystem.PlayEffectWithPosition("BulletDestroy", ImpactPosition, {-4, -4});
                     break;
                 }
             }
@@ -87,54 +119,118 @@ void ACollisionManager::CheckAllBulletCollisions(std::vector<ABullet*>& BulletsV
                 SoundManager.PlaySound("PlayerDamage");
             }
             
-            BulletsToRemove.emplace_back(Bullet);
-            continue;
+            Bullet->MarkActorPendingDestroy();
+        }
+        else if (bHitGameMap)
+        {
+            ParticleSystem.PlayEffectWithPosition("BulletDestroy", GetBulletImpactPosition(*Bullet, GameMapHit), {-4, -4});
+            Bullet->MarkActorPendingDestroy();
+        }
+    }
+
+    // Широкая фаза (sweep and prune): пули и враги отсортированы по левой границе,
+    // точная проверка выполняется только для пар с пересекающимися интервалами по X.
+    // Компоненты врагов не переставляются, сортируется только массив их индексов.
+    // Порядок индексов сохраняется между кадрами и заново заполняется только при изменении количества врагов
+    const std::vector<sf::FloatRect>& EnemyRects = EntityStore.CollisionRects;
+    if (SortedEnemyIndices.size() != EnemyRects.size())
+    {
+        SortedEnemyIndices.resize(EnemyRects.size());
+        std::iota(SortedEnemyIndices.begin(), SortedEnemyIndices.end(), 0u);
+    }
+    SortIndicesByLeftEdge(SortedEnemyIndices, EnemyRects);
+
+    float MaxEnemyWidth = 0.f;
+    for (const sf::FloatRect& EnemyRect : EnemyRects)
+    {
+        MaxEnemyWidth = std::max(MaxEnemyWidth, EnemyRect.width);
+    }
+
+    // Интервал пули расширен на её путь за кадр, учитываем наибольшее смещение, чтобы окно врагов оставалось монотонным
+    float MaxBulletTravel = 0.f;
+    for (const BulletSweepEntry& Entry : EnemyChannelBullets)
+    {
+        MaxBulletTravel = std::max(MaxBulletTravel, std::abs(Entry.Bullet->GetBulletDisplacement().x));
+    }
+
+    size_t FirstEnemyIndex = 0;
+    for (const BulletSweepEntry& Entry : EnemyChannelBullets)
+    {
+        ABullet* Bullet = Entry.Bullet;
+        const sf::FloatRect SweptBounds = GetSweptBounds(Bullet->GetBulletPreviousCollisionRect(),
+                                                         Bullet->GetBulletDisplacement());
+
+        // Пули идут по возрастанию левой границы, поэтому враги, оставшиеся левее пули, не понадобятся и дальше
+        while (FirstEnemyIndex < SortedEnemyIndices.size() &&
+               EnemyRects[SortedEnemyIndices[FirstEnemyIndex]].left + MaxEnemyWidth <
+               Bullet->GetActorCollisionRect().left - MaxBulletTravel)
+        {
+            ++FirstEnemyIndex;
         }
 
-        // Проверяем столкновение с врагом
-        for (APawn* Enemy : EnemyVectorPtr)
+        // Ищем врага, в которого пуля попадает раньше всего, среди врагов с пересекающимся интервалом по X
+        bool bHitEnemy = false;
+        uint32_t HitEnemyIndex = 0;
+        SweepHit EnemyHit;
+        for (size_t i = FirstEnemyIndex; i < SortedEnemyIndices.size(); ++i)
         {
-            if (CheckBulletCollisionWithPawn(*Bullet, Enemy->GetActorCollisionRect()) &&
-                Bullet->GetBulletType() == EBulletType::EBT_ShootAtEnemy)
+            const uint32_t EnemyIndex = SortedEnemyIndices[i];
+            if (EnemyRects[EnemyIndex].left > SweptBounds.left + SweptBounds.width)
             {
-                // Воспроизводим анимацию уничтожения для врагов
-                ParticleSystem.PlayEffectWithPosition("BulletDestroy", Bullet->GetActorPosition(), {-4, -4});
-                SoundManager.PlaySound("BulletHit");
+                break;
+            }
 
-                BulletsToRemove.emplace_back(Bullet);                
+            // Враг, убитый другой пулей в этом кадре, пули больше не задерживает
+            if (EntityStore.IsEntityPendingDestroy(EnemyIndex))
+            {
+                continue;
+            }
 
-                Enemy->TakeAwayPawnCurrentHealth(Bullet->GetBulletDamage());
+            SweepHit Hit;
+            if (SweepBulletAgainstPawn(*Bullet, EnemyRects[EnemyIndex], Hit) &&
+                (!bHitEnemy || Hit.TimeOfImpact < EnemyHit.TimeOfImpact))
+            {
+                bHitEnemy = true;
+                HitEnemyIndex = EnemyIndex;
+                EnemyHit = Hit;
+            }
+        }
 
-                if (Enemy->GetPawnCurrentHealth() <= DEATH)
+        // Пуля попадает во врага, только если долетела до него раньше, чем до препятствия
+        if (bHitEnemy && (!Entry.bHitGameMap || EnemyHit.TimeOfImpact <= Entry.GameMapHit.TimeOfImpact))
+        {
+            // Воспроизводим анимацию уничтожения для врагов
+            ParticleSystem.PlayEffectWithPosition("BulletDestroy", GetBulletImpactPosition(*Bullet, EnemyHit), {-4, -4});
+            SoundManager.PlaySound("BulletHit");
+
+            Bullet->MarkActorPendingDestroy();
+
+            HealthComponent& EnemyHealth = EntityStore.Healths[HitEnemyIndex];
+            EnemyHealth.CurrentHealth -= Bullet->GetBulletDamage();
+
+            // Враг помечается на уничтожение один раз, поэтому смерть обрабатывается один раз,
+            // даже если в него попало несколько пуль за кадр
+            if (EnemyHealth.CurrentHealth <= DEATH)
+            {
+                // Босс оставляет ключ на своей позиции, ключи создаются по порядку, не зависимо какой босс умрёт первый
+                if (EntityStore.GetEnemyArchetype(EntityStore.EnemyTypes[HitEnemyIndex]).bDropsKeyOnDeath)
                 {
-                    EnemyToRemove.emplace_back(Enemy);
+                    const EntityHandle NewKeyHandle = KeySlotMap.Insert(EntityStore.Transforms[HitEnemyIndex].Position);
+                    KeySlotMap.Get(NewKeyHandle)->InitKeys(SpriteManager);
+                    ++AKeyObject::KeysCountFound;
+                    KeyHandles.emplace_back(NewKeyHandle);
                 }
 
-                // Выходим из цикла по врагам, так как пуля должна быть удалена
-                break;
+                SoundManager.PlaySound("EnemyDeath");
+                EntityStore.MarkEntityPendingDestroy(HitEnemyIndex);
             }
         }
-    }
-
-    // Удаляем пули, столкнувшиеся с препятствиями или врагами
-    for (ABullet* BulletRemove : BulletsToRemove)
-    {
-        std::erase(BulletsVectorPtr, BulletRemove);
-        delete BulletRemove;
-    }
-
-    // Удаляем врагов, которых убили пули
-    for (APawn* EnemyRemove : EnemyToRemove)
-    {
-        ABossEnemy* BossEnemy = dynamic_cast<ABossEnemy*>(EnemyRemove);
-        if (BossEnemy && BossEnemy->GetPawnCurrentHealth() <= DEATH)
+        else if (Entry.bHitGameMap)
         {
-            BossEnemy->OnDeath(KeysVectorPtr, SpriteManager, BossEnemy->GetActorPosition());
+            ParticleSystem.PlayEffectWithPosition("BulletDestroy", GetBulletImpactPosition(*Bullet, Entry.GameMapHit),
+                                                  {-4, -4});
+            Bullet->MarkActorPendingDestroy();
         }
-
-        SoundManager.PlaySound("EnemyDeath");
-        std::erase(EnemyVectorPtr, EnemyRemove);
-        delete EnemyRemove;
     }
 }
 
@@ -155,255 +251,654 @@ void ACollisionManager::HandlePawnCollisionWithGameMap(sf::FloatRect& PawnRect,
 {
     bCanClimb = false;
 
-    // Проверяем столкнование персонажа с препятствиями игровой карты
-    for (auto it = GameMapRef.GetGameMapCollisionVector().begin(); it != GameMapRef.GetGameMapCollisionVector().end();)
+    // Область поиска расширена на размер пешки, так как при выталкивании её прямоугольник смещается
+    sf::FloatRect QueryArea(PawnRect.left - PawnRect.width, PawnRect.top - PawnRect.height,
+                            PawnRect.width * 3.f, PawnRect.height * 3.f);
+    GameMapRef.QueryObstacles(QueryArea, ObstacleCandidates);
+
+    // Проверяем столкнование персонажа с препятствиями игровой карты рядом с ним
+    for (uint32_t ObstacleIndex : ObstacleCandidates)
     {
-        auto& Obstacle = *it;
+        const sf::FloatRect& Obstacle = GameMapRef.GetGameMapCollisionVector()[ObstacleIndex];
+
+        if (ResolveObstacleOverlap(PawnRect, ObjectVelocity, Obstacle) == ECollisionSide::ECS_Top)
+        {
+            bCanJump = true;
+        }
+    }
 
-        if (PawnRect.intersects(Obstacle))
+    // Проверяем столкнование персонажа с твёрдыми тайлами рядом с ним
+    GameMapRef.GetTileCollisionMap().CollectSolidTileRects(QueryArea, SolidTileCandidates);
+    for (const sf::FloatRect& SolidTile : SolidTileCandidates)
+    {
+        if (ResolveObstacleOverlap(PawnRect, ObjectVelocity, SolidTile) == ECollisionSide::ECS_Top)
         {
-            // Рассчитываем перекрытие
-            float OverlapLeft = (PawnRect.left + PawnRect.width) - Obstacle.left;
-            float OverlapRight = (Obstacle.left + Obstacle.width) - PawnRect.left;
-            float OverlapTop = (PawnRect.top + PawnRect.height) - Obstacle.top;
-            float OverlapBottom = (Obstacle.top + Obstacle.height) - PawnRect.top;
+            bCanJump = true;
+        }
+    }
 
-            bool FromLeft = std::abs(OverlapLeft) < std::abs(OverlapRight);
-            bool FromTop = std::abs(OverlapTop) < std::abs(OverlapBottom);
+    // Проверяем столкнование персонажа с включёнными динамическими препятствиями (ворота)
+    const ADynamicObstacleLayer& DynamicObstacleLayer = GameMapRef.GetDynamicObstacleLayer();
+    DynamicObstacleLayer.QueryObstacles(QueryArea, ObstacleCandidates);
+    for (uint32_t ObstacleID : ObstacleCandidates)
+    {
+        const sf::FloatRect& Obstacle = DynamicObstacleLayer.GetObstacles()[ObstacleID].ObstacleRect;
 
-            float MinOverlapX = FromLeft ? OverlapLeft : OverlapRight;
-            float MinOverlapY = FromTop ? OverlapTop : OverlapBottom;
+        if (ResolveObstacleOverlap(PawnRect, ObjectVelocity, Obstacle) == ECollisionSide::ECS_Top)
+        {
+            bCanJump = true;
+        }
+    }
 
-            // Если перекрытие по X меньше, чем по Y, это горизонтальное столкновение
-            if (std::abs(MinOverlapX) < std::abs(MinOverlapY))
+    // Обновляем пересечения персонажа с зонами-триггерами, смена состояний срабатывает один раз при входе
+    GameMapRef.GetTriggerVolumeLayer().UpdateOverlaps(PawnRect, PlayerRef.GetPawnTriggerOverlapState(),
+        [this, &bCanClimb, SoundManager](ETriggerEvent TriggerEvent, const TriggerVolume& Trigger)
+        {
+            if (TriggerEvent == ETriggerEvent::ETE_Exit)
             {
-                // Корректируем положение по X
-                PawnRect.left += FromLeft ? -OverlapLeft : OverlapRight;
-
-                // Останавливаем горизонтальное движение
-                ObjectVelocity.x = 0.f;
+                return;
             }
-            // В противном случае это вертикальное столкновение
-            else
-            {
-                // Корректируем положение по Y
-                PawnRect.top += FromTop ? -OverlapTop : OverlapBottom;
-
-                // Останавливаем вертикальное движение
-                ObjectVelocity.y = 0.f;
 
-                if (FromTop)
+            switch (Trigger.TriggerType)
+            {
+            // Персонаж находится на лестнице
+            case ETriggerType::ETT_Ladder:
                 {
-                    bCanJump = true;
+                    bCanClimb = true;
+                    break;
+                }
+            // Когда мы пересечём ворота, меняем состояние на Путь к эвакуации,
+            // будет становится фоновая музыка тише, а вертолёт громче
+            case ETriggerType::ETT_SoundHelicopter:
+                {
+                    if (TriggerEvent == ETriggerEvent::ETE_Enter)
+                    {
+                        GameStateRef.SetGameState(EGameState::EGS_EscapeRoute);
+                    }
+                    break;
+                }
+            // Дойдя до флага, мы устанавливаем состояние игры на миссия выполнена
+            case ETriggerType::ETT_MissionAccomplished:
+                {
+                    if (TriggerEvent == ETriggerEvent::ETE_Enter)
+                    {
+                        GameStateRef.SetGameState(EGameState::EGS_MissionCompleted);
+                    }
+                    break;
+                }
+            // Персонаж попал на участок карты с лавой или пиками, который наносит урон
+            case ETriggerType::ETT_LavaDamage:
+            case ETriggerType::ETT_PeaksDamage:
+                {
+                    if (TriggerEvent == ETriggerEvent::ETE_Enter && !PlayerRef.GetIsDeathPlayer())
+                    {
+                        // Проиграть звук лавы или пронзания пик
+                        if (SoundManager)
+                        {
+                            SoundManager->PlaySound(Trigger.TriggerType == ETriggerType::ETT_LavaDamage ? "Lava" : "Peaks");
+                        }
+
+                        // Устанавливаем флаг для персонажа(игрока) на "Умер", если пересекли коллизию с уроном
+                        PlayerRef.SetIsDeathPlayer(true);
+                    }
+                    break;
+                }
+            default:
+                {
+                    break;
                 }
             }
+        });
+}
+
+/**
+* @brief Проверяет столкновение с ключами.
+* 
+* Подобранные ключи переносятся в вектор найденных ключей, дескрипторы удалённых ключей отбрасываются.
+*
+* @param KeySlotMap Карта слотов, которая владеет ключами.
+* @param KeyHandles Дескрипторы ключей, которые ещё не подобраны.
+* @param SoundManager Ссылка на менеджер звуков.
+*/
+void ACollisionManager::CheckCollisionWithKey(TSlotMap<AKeyObject>& KeySlotMap,
+                                              std::vector<EntityHandle>& KeyHandles,
+                                              ASoundManager& SoundManager)
+{
+    for (auto it = KeyHandles.begin(); it != KeyHandles.end();)
+    {
+        AKeyObject* Key = KeySlotMap.Get(*it);
+        if (!Key)
+        {
+            it = KeyHandles.erase(it); // Ключ уже удалён, дескриптор больше не нужен
+            continue;
         }
 
-        // Проверка условия для удаления Obstacle (коллизия двери)
-        if (AChestObject::ChestOpenCountStatic == OPEN_ALL_CHESTS)
+        if (CheckCollision(PlayerRef.GetActorCollisionRect(), Key->GetActorCollisionRect()))
         {
-            // Координаты и размер коллизии двери
-            sf::FloatRect DoorCollisionRect(5056.33f, 481.08f, 15.33f, 94.58f);
+            // Воспроизвести звук, когда персонаж подобрал ключ
+            SoundManager.PlaySound("KeyFound");
 
-            if (Obstacle.intersects(DoorCollisionRect))
-            {
-                // Удаление из вектора
-                it = GameMapRef.GetGameMapCollisionVector().erase(it);
+            Key->SetKeyFound(false);
+            GameStateRef.GetFoundKeyHandles().emplace_back(*it); // Добавляем ключ в вектор найденных ключей
+            it = KeyHandles.erase(it); // Удаляем ключ из вектора ключей, которые ещё не подобраны
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
 
-                // Переход к следующему элементу
-                continue;
-            }
+/**
+* @brief Проверяет столкновение с игровой картой.
+* 
+* @param ActorRect Прямоугольник коллизии актера.
+* @param ObjectVelocity Вектор скорости объекта.
+* 
+* @return true, если актер столкнулся с препятствием сбоку (враги при этом разворачиваются).
+*/
+bool ACollisionManager::CheckCollisionWithGameMap(sf::FloatRect& ActorRect,
+                                                  sf::Vector2f& ObjectVelocity) const
+{
+    bool bHitHorizontal = false;
+
+    // Область поиска расширена на размер актера, так как при выталкивании его прямоугольник смещается
+    sf::FloatRect QueryArea(ActorRect.left - ActorRect.width, ActorRect.top - ActorRect.height,
+                            ActorRect.width * 3.f, ActorRect.height * 3.f);
+    GameMapRef.QueryObstacles(QueryArea, ObstacleCandidates);
+
+    // Проверяем столкнование с препятствиями игровой карты рядом с актером
+    for (uint32_t ObstacleIndex : ObstacleCandidates)
+    {
+        const sf::FloatRect& Obstacle = GameMapRef.GetGameMapCollisionVector()[ObstacleIndex];
+
+        if (ResolveObstacleOverlap(ActorRect, ObjectVelocity, Obstacle) == ECollisionSide::ECS_Horizontal)
+        {
+            bHitHorizontal = true;
         }
+    }
 
-        // Переход к следующему элементу, если ничего не было удалено
-        ++it;
+    // Проверяем столкнование с твёрдыми тайлами рядом с актером
+    GameMapRef.GetTileCollisionMap().CollectSolidTileRects(QueryArea, SolidTileCandidates);
+    for (const sf::FloatRect& SolidTile : SolidTileCandidates)
+    {
+        if (ResolveObstacleOverlap(ActorRect, ObjectVelocity, SolidTile) == ECollisionSide::ECS_Horizontal)
+        {
+            bHitHorizontal = true;
+        }
     }
 
-    // Когда мы пересечём ворота, меняем состояние на Путь к эвакуации,
-    // будет становится фоновая музыка тише, а вертолёт громче
-    if (PawnRect.intersects(GameMapRef.GetSpawnSoundHelicopterLayer()))
+    // Проверяем столкнование с включёнными динамическими препятствиями (ворота)
+    const ADynamicObstacleLayer& DynamicObstacleLayer = GameMapRef.GetDynamicObstacleLayer();
+    DynamicObstacleLayer.QueryObstacles(QueryArea, ObstacleCandidates);
+    for (uint32_t ObstacleID : ObstacleCandidates)
     {
-        GameStateRef.SetGameState(EGameState::EGS_EscapeRoute);
+        const sf::FloatRect& Obstacle = DynamicObstacleLayer.GetObstacles()[ObstacleID].ObstacleRect;
+
+        if (ResolveObstacleOverlap(ActorRect, ObjectVelocity, Obstacle) == ECollisionSide::ECS_Horizontal)
+        {
+            bHitHorizontal = true;
+        }
     }
 
-    // Дойдя до флага, мы устанавливаем состояние игры на миссия выполнена 
-    if (PawnRect.intersects(GameMapRef.GetMissionAccomplishedLayer()))
+    return bHitHorizontal;
+}
+
+/**
+* @brief Пускает луч от одной точки к другой и ищет первое препятствие на пути.
+* 
+* @param From Начало луча.
+* @param To Конец луча.
+* @param OutHit Точка и расстояние попадания (если попадания нет, точка конца луча).
+* 
+* @return true, если луч пересекает препятствие, иначе false.
+*/
+bool ACollisionManager::Raycast(const sf::Vector2f& From, const sf::Vector2f& To, RaycastHit& OutHit) const
+{
+    const sf::Vector2f Delta = To - From;
+
+    // Ищем ближайшее попадание среди прямоугольников препятствий и твёрдых тайлов
+    float HitFraction = 1.f;
+    bool bHit = RaycastObstacles(From, To, HitFraction);
+
+    float TileHitFraction = 1.f;
+    if (GameMapRef.GetTileCollisionMap().RaycastSolid(From, To, TileHitFraction) &&
+        (!bHit || TileHitFraction < HitFraction))
     {
-        GameStateRef.SetGameState(EGameState::EGS_MissionCompleted);
+        HitFraction = TileHitFraction;
+        bHit = true;
     }
 
-    // Проверяем, находится ли персонаж на участки карты лавы, который наносит урон
-    for (const auto& DamageLayer : GameMapRef.GetLavaDamageCollisionVector())
+    // Динамических препятствий мало, проверяем те, что попадают в границы луча.
+    // Границы расширены на пиксель, иначе у вертикального или горизонтального луча они нулевой ширины
+    // и не пересекают ни одного прямоугольника
+    const ADynamicObstacleLayer& DynamicObstacleLayer = GameMapRef.GetDynamicObstacleLayer();
+    DynamicObstacleLayer.QueryObstacles(GetSweptBounds({From.x - 1.f, From.y - 1.f, 2.f, 2.f}, Delta),
+                                        ObstacleCandidates);
+    for (uint32_t ObstacleID : ObstacleCandidates)
     {
-        if (PawnRect.intersects(DamageLayer))
+        float EnterFraction = 0.f;
+        if (IntersectSegmentWithRect(From, Delta, DynamicObstacleLayer.GetObstacles()[ObstacleID].ObstacleRect,
+                                     EnterFraction) &&
+            (!bHit || EnterFraction < HitFraction))
         {
-            // Проиграть звук лавы
-            SoundManager->PlaySound("Lava");
+            HitFraction = EnterFraction;
+            bHit = true;
+        }
+    }
 
-            // Устанавливаем флаг для персонажа(игрока) на "Умер", если пересекли коллизию с уроном
-            bool PlayerDeath = true;
-            PlayerRef.SetIsDeathPlayer(PlayerDeath);
+    OutHit.HitPoint = From + Delta * HitFraction;
+    OutHit.Distance = std::sqrt(Delta.x * Delta.x + Delta.y * Delta.y) * HitFraction;
 
-            break;
-        }
+    return bHit;
+}
+
+/**
+* @brief Проверяет движущийся прямоугольник с неподвижным по пути перемещения (swept AABB).
+* 
+* @param MovingRect Прямоугольник в начале перемещения.
+* @param Displacement Смещение прямоугольника за кадр.
+* @param Target Неподвижный прямоугольник.
+* @param OutHit Время касания и нормаль поверхности Target в точке касания.
+* 
+* @return true, если прямоугольники пересекутся во время перемещения, иначе false.
+*/
+bool ACollisionManager::SweepAABB(const sf::FloatRect& MovingRect,
+                                  const sf::Vector2f& Displacement,
+                                  const sf::FloatRect& Target,
+                                  SweepHit& OutHit)
+{
+    // Прямоугольники уже пересекаются в начале перемещения
+    if (MovingRect.intersects(Target))
+    {
+        OutHit.TimeOfImpact = 0.f;
+        OutHit.Normal = {0.f, 0.f};
+        return true;
     }
 
-    // Проверяем, находится ли персонаж на участки карты с пиками, который наносит урон
-    for (const auto& DamageLayer : GameMapRef.GetPeaksDamageCollisionVector())
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+    // Доли перемещения, на которых интервалы по X и Y начинают и перестают пересекаться
+    float EntryX = -Infinity;
+    float ExitX = Infinity;
+    if (Displacement.x > 0.f)
     {
-        if (PawnRect.intersects(DamageLayer))
-        {
-            // Проиграть звук пронзания пик
-            SoundManager->PlaySound("Peaks");
+        EntryX = (Target.left - (MovingRect.left + MovingRect.width)) / Displacement.x;
+        ExitX = (Target.left + Target.width - MovingRect.left) / Displacement.x;
+    }
+    else if (Displacement.x < 0.f)
+    {
+        EntryX = (Target.left + Target.width - MovingRect.left) / Displacement.x;
+        ExitX = (Target.left - (MovingRect.left + MovingRect.width)) / Displacement.x;
+    }
+    else if (MovingRect.left >= Target.left + Target.width || MovingRect.left + MovingRect.width <= Target.left)
+    {
+        return false;
+    }
 
-            // Устанавливаем флаг для персонажа(игрока) на "Умер", если пересекли коллизию с уроном
-            bool PlayerDeath = true;
-            PlayerRef.SetIsDeathPlayer(PlayerDeath);
+    float EntryY = -Infinity;
+    float ExitY = Infinity;
+    if (Displacement.y > 0.f)
+    {
+        EntryY = (Target.top - (MovingRect.top + MovingRect.height)) / Displacement.y;
+        ExitY = (Target.top + Target.height - MovingRect.top) / Displacement.y;
+    }
+    else if (Displacement.y < 0.f)
+    {
+        EntryY = (Target.top + Target.height - MovingRect.top) / Displacement.y;
+        ExitY = (Target.top - (MovingRect.top + MovingRect.height)) / Displacement.y;
+    }
+    else if (MovingRect.top >= Target.top + Target.height || MovingRect.top + MovingRect.height <= Target.top)
+    {
+        return false;
+    }
 
-            break;
-        }
+    const float EntryTime = std::max(EntryX, EntryY);
+    const float ExitTime = std::min(ExitX, ExitY);
+
+    // Касание без перекрытия, как и в sf::FloatRect::intersects, столкновением не считается
+    if (EntryTime >= ExitTime || EntryTime < 0.f || EntryTime > 1.f)
+    {
+        return false;
     }
 
-    // Проверяем, находится ли персонаж на лестнице
-    for (const auto& LadderLayer : GameMapRef.GetLadderCollisionVector())
+    OutHit.TimeOfImpact = EntryTime;
+
+    // Нормаль направлена от поверхности препятствия, в которую вошёл прямоугольник
+    if (EntryX > EntryY)
     {
-        if (PawnRect.intersects(LadderLayer))
-        {
-            bCanClimb = true;
-            break;
-        }
+        OutHit.Normal = {Displacement.x > 0.f ? -1.f : 1.f, 0.f};
+    }
+    else
+    {
+        OutHit.Normal = {0.f, Displacement.y > 0.f ? -1.f : 1.f};
     }
+
+    return true;
 }
 
 /**
-* @brief Проверяет столкновение с ключами.
+* @brief Проверяет столкновение пули с игровой картой по всему пути пули за кадр.
 * 
-* @param KeysVectorPtr Указатель на вектор ключей.
-* @param SoundManager Ссылка на менеджер звуков.
+* @param Bullet Пуля для проверки столкновения.
+* @param OutHit Время касания и нормаль ближайшего препятствия.
+* 
+* @return true, если пуля столкнулась с препятствием или твёрдым тайлом, иначе false.
 */
-void ACollisionManager::CheckCollisionWithKey(std::vector<AKeyObject*>& KeysVectorPtr, ASoundManager& SoundManager)
+bool ACollisionManager::SweepBulletAgainstGameMap(ABullet& Bullet, SweepHit& OutHit) const
 {
-    // Вектор для хранения найденных ключей
-    std::vector<AKeyObject*> FoundKeys;
+    const sf::FloatRect& StartRect = Bullet.GetBulletPreviousCollisionRect();
+    const sf::Vector2f Displacement = Bullet.GetBulletDisplacement();
+    const sf::FloatRect SweptBounds = GetSweptBounds(StartRect, Displacement);
+
+    bool bHit = false;
 
-    for (auto it = KeysVectorPtr.begin(); it != KeysVectorPtr.end();)
+    // Проверяем препятствия из ячеек сетки, которые покрывает путь пули
+    GameMapRef.QueryObstacles(SweptBounds, ObstacleCandidates);
+    for (uint32_t ObstacleIndex : ObstacleCandidates)
     {
-        // Воспроизвести звук, когда персонаж подобрал ключ
-        SoundManager.PlaySound("KeyFound");
+        SweepHit Hit;
+        if (SweepAABB(StartRect, Displacement, GameMapRef.GetGameMapCollisionVector()[ObstacleIndex], Hit) &&
+            (!bHit || Hit.TimeOfImpact < OutHit.TimeOfImpact))
+        {
+            OutHit = Hit;
+            bHit = true;
+        }
+    }
 
-        if (CheckCollision(PlayerRef.GetActorCollisionRect(), (*it)->GetActorCollisionRect()))
+    // Проверяем твёрдые тайлы, которые покрывает путь пули
+    GameMapRef.GetTileCollisionMap().CollectSolidTileRects(SweptBounds, SolidTileCandidates);
+    for (const sf::FloatRect& SolidTile : SolidTileCandidates)
+    {
+        SweepHit Hit;
+        if (SweepAABB(StartRect, Displacement, SolidTile, Hit) && (!bHit || Hit.TimeOfImpact < OutHit.TimeOfImpact))
         {
-            (*it)->SetKeyFound(false);
-            GameStateRef.GetFoundKeysVector().emplace_back(*it); // Добавляем ключ в вектор найденных ключей
-            it = KeysVectorPtr.erase(it); // Удаляем ключ из общего вектора
+            OutHit = Hit;
+            bHit = true;
         }
-        else
+    }
+
+    // Проверяем включённые динамические препятствия, которые покрывает путь пули
+    const ADynamicObstacleLayer& DynamicObstacleLayer = GameMapRef.GetDynamicObstacleLayer();
+    DynamicObstacleLayer.QueryObstacles(SweptBounds, ObstacleCandidates);
+    for (uint32_t ObstacleID : ObstacleCandidates)
+    {
+        SweepHit Hit;
+        if (SweepAABB(StartRect, Displacement, DynamicObstacleLayer.GetObstacles()[ObstacleID].ObstacleRect, Hit) &&
+            (!bHit || Hit.TimeOfImpact < OutHit.TimeOfImpact))
         {
-            ++it;
+            OutHit = Hit;
+            bHit = true;
         }
     }
+
+    return bHit;
 }
 
 /**
-* @brief Проверяет столкновение с игровой картой.
+* @brief Проверяет столкновение пули с пешкой (персонажем или врагом) по всему пути пули за кадр.
 * 
-* @param ActorRect Прямоугольник коллизии актера.
-* @param ObjectVelocity Вектор скорости объекта.
-* @param EnemyPtr Указатель на врага.
+* @param Bullet Пуля для проверки столкновения.
+* @param PawnRect Прямоугольник пешки.
+* @param OutHit Время касания и нормаль поверхности пешки.
+* 
+* @return true, если пуля задела пешку, иначе false.
 */
-void ACollisionManager::CheckCollisionWithGameMap(sf::FloatRect& ActorRect,
-                                                  sf::Vector2f& ObjectVelocity,
-                                                  AEnemy* EnemyPtr) const
+bool ACollisionManager::SweepBulletAgainstPawn(ABullet& Bullet, const sf::FloatRect& PawnRect, SweepHit& OutHit) const
 {
-    // Проверяем столкнование с препятствиями игровой карты
-    for (const auto& Obstacle : GameMapRef.GetGameMapCollisionVector())
-    {
-        if (ActorRect.intersects(Obstacle))
-        {
-            // Рассчитываем перекрытие по всем сторонам препятствия
-            float OverlapLeft = (ActorRect.left + ActorRect.width) - Obstacle.left;
-            float OverlapRight = (Obstacle.left + Obstacle.width) - ActorRect.left;
-            float OverlapTop = (ActorRect.top + ActorRect.height) - Obstacle.top;
-            float OverlapBottom = (Obstacle.top + Obstacle.height) - ActorRect.top;
+    return SweepAABB(Bullet.GetBulletPreviousCollisionRect(), Bullet.GetBulletDisplacement(), PawnRect, OutHit);
+}
 
-            // Определяем направление, откуда пришло столкновение
-            bool FromLeft = std::abs(OverlapLeft) < std::abs(OverlapRight);
-            bool FromTop = std::abs(OverlapTop) < std::abs(OverlapBottom);
+/**
+* @brief Пускает луч по ячейкам сетки препятствий карты.
+* 
+* @param From Начало луча.
+* @param To Конец луча.
+* @param InOutHitFraction Доля пути до ближайшего попадания, уменьшается при нахождении более близкого.
+* 
+* @return true, если найдено попадание ближе InOutHitFraction, иначе false.
+*/
+bool ACollisionManager::RaycastObstacles(const sf::Vector2f& From, const sf::Vector2f& To, float& InOutHitFraction) const
+{
+    const ASpatialGrid& ObstacleGrid = GameMapRef.GetObstacleGrid();
+    if (ObstacleGrid.IsGridEmpty())
+    {
+        return false;
+    }
 
-            // Выбираем минимальное перекрытие по X и Y
-            float MinOverlapX = FromLeft ? OverlapLeft : OverlapRight;
-            float MinOverlapY = FromTop ? OverlapTop : OverlapBottom;
+    const std::vector<sf::FloatRect>& Obstacles = GameMapRef.GetGameMapCollisionVector();
+    const sf::Vector2f& Origin = ObstacleGrid.GetGridOrigin();
+    const sf::Vector2i& GridSize = ObstacleGrid.GetGridSize();
+    const float CellSize = ObstacleGrid.GetCellSize();
+    const sf::Vector2f Delta = To - From;
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+    // Ячейки начала и конца луча
+    sf::Vector2i Cell(static_cast<int>(std::floor((From.x - Origin.x) / CellSize)),
+                      static_cast<int>(std::floor((From.y - Origin.y) / CellSize)));
+    const sf::Vector2i LastCell(static_cast<int>(std::floor((To.x - Origin.x) / CellSize)),
+                                static_cast<int>(std::floor((To.y - Origin.y) / CellSize)));
+
+    // Направление шага и доля пути до ближайшей границы ячейки по каждой оси (алгоритм Amanatides-Woo)
+    const sf::Vector2i Step(Delta.x > 0.f ? 1 : (Delta.x < 0.f ? -1 : 0), Delta.y > 0.f ? 1 : (Delta.y < 0.f ? -1 : 0));
+    const sf::Vector2f StepFraction(Step.x != 0 ? CellSize / std::abs(Delta.x) : Infinity,
+                                    Step.y != 0 ? CellSize / std::abs(Delta.y) : Infinity);
+    sf::Vector2f NextBoundary(
+        Step.x != 0 ? (Origin.x + (Cell.x + (Step.x > 0 ? 1 : 0)) * CellSize - From.x) / Delta.x : Infinity,
+        Step.y != 0 ? (Origin.y + (Cell.y + (Step.y > 0 ? 1 : 0)) * CellSize - From.y) / Delta.y : Infinity);
+
+    bool bHit = false;
+    const int StepCount = std::abs(LastCell.x - Cell.x) + std::abs(LastCell.y - Cell.y);
+
+    for (int i = 0; i <= StepCount; ++i)
+    {
+        // Препятствия за границей сетки хранятся в крайних ячейках, поэтому ограничиваем координаты
+        const int CellX = std::clamp(Cell.x, 0, GridSize.x - 1);
+        const int CellY = std::clamp(Cell.y, 0, GridSize.y - 1);
 
-            // Если перекрытие по X меньше, чем по Y, это горизонтальное столкновение
-            if (std::abs(MinOverlapX) < std::abs(MinOverlapY))
+        for (uint32_t ObstacleIndex : ObstacleGrid.GetCellItems(CellX, CellY))
+        {
+            float EnterFraction = 0.f;
+            if (IntersectSegmentWithRect(From, Delta, Obstacles[ObstacleIndex], EnterFraction) &&
+                EnterFraction < InOutHitFraction)
             {
-                // Корректируем положение по X
-                ActorRect.left += FromLeft ? -OverlapLeft : OverlapRight;
+                InOutHitFraction = EnterFraction;
+                bHit = true;
+            }
+        }
 
-                // Останавливаем горизонтальное движение
-                ObjectVelocity.x = 0.f;
+        // Попадание внутри текущей ячейки ближе любой следующей ячейки, дальше идти не нужно
+        const float ExitFraction = std::min(NextBoundary.x, NextBoundary.y);
+        if (bHit && InOutHitFraction <= ExitFraction)
+        {
+            break;
+        }
 
-                if (EnemyPtr)
-                {
-                    EnemyPtr->ChangeDirection();
-                }
-            }
-            else // В противном случае это вертикальное столкновение
-            {
-                // Корректируем положение по Y
-                ActorRect.top += FromTop ? -OverlapTop : OverlapBottom;
+        // Переходим в соседнюю ячейку через ближайшую границу
+        if (NextBoundary.x < NextBoundary.y)
+        {
+            NextBoundary.x += StepFraction.x;
+            Cell.x += Step.x;
+        }
+        else
+        {
+            NextBoundary.y += StepFraction.y;
+            Cell.y += Step.y;
+        }
 
-                // Останавливаем вертикальное движение
-                ObjectVelocity.y = 0.f;
-            }
+        if (ExitFraction > 1.f)
+        {
+            break;
         }
     }
+
+    return bHit;
 }
 
 /**
-* @brief Проверяет столкновение пули с игровой картой.
+* @brief Находит точку входа отрезка в прямоугольник.
 * 
-* @param Bullet Пуля для проверки столкновения.
+* @param From Начало отрезка.
+* @param Delta Вектор от начала до конца отрезка.
+* @param Rect Прямоугольник для проверки.
+* @param OutEnterFraction Доля пути до точки входа (0, если отрезок начинается внутри).
 * 
-* @return true, если есть столкновение с игровой картой, иначе false.
+* @return true, если отрезок пересекает прямоугольник, иначе false.
 */
-bool ACollisionManager::CheckBulletCollisionWithGameMap(AActor& Bullet) const
+bool ACollisionManager::IntersectSegmentWithRect(const sf::Vector2f& From,
+                                                 const sf::Vector2f& Delta,
+                                                 const sf::FloatRect& Rect,
+                                                 float& OutEnterFraction)
 {
-    // Получаем границы камеры (вьюпорт)
-    sf::FloatRect CameraBounds = GetCameraBounds();
+    float EnterFraction = 0.f;
+    float ExitFraction = 1.f;
 
-    // Проверяем, выходит ли пуля за границы видимой области
-    if (!CameraBounds.intersects(Bullet.GetActorCollisionRect()))
+    // Метод разделяющих полос: пересекаем интервалы отрезка внутри полос по X и по Y
+    const float Origins[2] = {From.x, From.y};
+    const float Directions[2] = {Delta.x, Delta.y};
+    const float Mins[2] = {Rect.left, Rect.top};
+    const float Maxs[2] = {Rect.left + Rect.width, Rect.top + Rect.height};
+
+    for (int Axis = 0; Axis < 2; ++Axis)
     {
-        return true; // Пуля вышла за границы экрана
+        if (Directions[Axis] == 0.f)
+        {
+            // Отрезок параллелен полосе и лежит вне её
+            if (Origins[Axis] < Mins[Axis] || Origins[Axis] > Maxs[Axis])
+            {
+                return false;
+            }
+            continue;
+        }
+
+        float NearFraction = (Mins[Axis] - Origins[Axis]) / Directions[Axis];
+        float FarFraction = (Maxs[Axis] - Origins[Axis]) / Directions[Axis];
+        if (NearFraction > FarFraction)
+        {
+            std::swap(NearFraction, FarFraction);
+        }
+
+        EnterFraction = std::max(EnterFraction, NearFraction);
+        ExitFraction = std::min(ExitFraction, FarFraction);
+
+        if (EnterFraction > ExitFraction)
+        {
+            return false;
+        }
     }
 
-    // Перебираем все объекты коллизий на игровой карте
-    for (const auto& Collision : GameMapRef.GetGameMapCollisionVector())
+    OutEnterFraction = EnterFraction;
+    return true;
+}
+
+/**
+* @brief Сортирует индексы прямоугольников по их левой границе вставками.
+* 
+* @param Indices Индексы прямоугольников, отсортированные на прошлом кадре.
+* @param Rects Прямоугольники коллизий.
+*/
+void ACollisionManager::SortIndicesByLeftEdge(std::vector<uint32_t>& Indices, const std::vector<sf::FloatRect>& Rects)
+{
+    for (size_t i = 1; i < Indices.size(); ++i)
     {
-        if (Bullet.GetActorCollisionRect().intersects(Collision))
+        const uint32_t Index = Indices[i];
+        const float Left = Rects[Index].left;
+
+        size_t j = i;
+        while (j > 0 && Rects[Indices[j - 1]].left > Left)
         {
-            return true; // Столкновение обнаружено
+            Indices[j] = Indices[j - 1];
+            --j;
         }
+
+        Indices[j] = Index;
     }
+}
 
-    return false; // Столкновение не обнаружено
+/**
+* @brief Получает прямоугольник, охватывающий весь путь перемещения прямоугольника.
+* 
+* @param Rect Прямоугольник в начале перемещения.
+* @param Displacement Смещение прямоугольника.
+* 
+* @return Прямоугольник, охватывающий начальное и конечное положение.
+*/
+sf::FloatRect ACollisionManager::GetSweptBounds(const sf::FloatRect& Rect, const sf::Vector2f& Displacement)
+{
+    return {
+        Rect.left + std::min(0.f, Displacement.x),
+        Rect.top + std::min(0.f, Displacement.y),
+        Rect.width + std::abs(Displacement.x),
+        Rect.height + std::abs(Displacement.y)
+    };
 }
 
 /**
-* @brief Проверяет столкновение пули с объектом (персонажем или врагом).
+* @brief Получает позицию пули в момент касания.
 * 
-* @param Bullet Пуля для проверки столкновения.
-* @param PawnRect Прямоугольник объекта для проверки.
+* @param Bullet Пуля.
+* @param Hit Результат проверки пули по пути перемещения.
 * 
-* @return true, если есть столкновение с объектом, иначе false.
+* @return Позиция пули в момент касания.
 */
-bool ACollisionManager::CheckBulletCollisionWithPawn(AActor& Bullet, const sf::FloatRect& PawnRect) const
+sf::Vector2f ACollisionManager::GetBulletImpactPosition(const ABullet& Bullet, const SweepHit& Hit)
 {
-    // Проверяем, пересекается ли коллайдер пули с прямоугольником пешки
-    return Bullet.GetActorCollisionRect().intersects(PawnRect);
+    const sf::FloatRect& StartRect = Bullet.GetBulletPreviousCollisionRect();
+    return sf::Vector2f(StartRect.left, StartRect.top) + Bullet.GetBulletDisplacement() * Hit.TimeOfImpact;
 }
 
+/**
+* @brief Выталкивает прямоугольник из препятствия по оси наименьшего перекрытия.
+* 
+* @param Rect Прямоугольник коллизии актера.
+* @param ObjectVelocity Вектор скорости актера, по оси столкновения скорость обнуляется.
+* @param Obstacle Прямоугольник препятствия.
+* 
+* @return Сторона, с которой произошло столкновение, или ECS_None, если пересечения нет.
+*/
+ECollisionSide ACollisionManager::ResolveObstacleOverlap(sf::FloatRect& Rect,
+                                                         sf::Vector2f& ObjectVelocity,
+                                                         const sf::FloatRect& Obstacle) const
+{
+    if (!Rect.intersects(Obstacle))
+    {
+        return ECollisionSide::ECS_None;
+    }
+
+    // Рассчитываем перекрытие по всем сторонам препятствия
+    float OverlapLeft = (Rect.left + Rect.width) - Obstacle.left;
+    float OverlapRight = (Obstacle.left + Obstacle.width) - Rect.left;
+    float OverlapTop = (Rect.top + Rect.height) - Obstacle.top;
+    float OverlapBottom = (Obstacle.top + Obstacle.height) - Rect.top;
+
+    // Определяем направление, откуда пришло столкновение
+    bool FromLeft = std::abs(OverlapLeft) < std::abs(OverlapRight);
+    bool FromTop = std::abs(OverlapTop) < std::abs(OverlapBottom);
+
+    // Выбираем минимальное перекрытие по X и Y
+    float MinOverlapX = FromLeft ? OverlapLeft : OverlapRight;
+    float MinOverlapY = FromTop ? OverlapTop : OverlapBottom;
+
+    // Если перекрытие по X меньше, чем по Y, это горизонтальное столкновение
+    if (std::abs(MinOverlapX) < std::abs(MinOverlapY))
+    {
+        // Корректируем положение по X
+        Rect.left += FromLeft ? -OverlapLeft : OverlapRight;
+
+        // Останавливаем горизонтальное движение
+        ObjectVelocity.x = 0.f;
+
+        return ECollisionSide::ECS_Horizontal;
+    }
+
+    // В противном случае это вертикальное столкновение, корректируем положение по Y
+    Rect.top += FromTop ? -OverlapTop : OverlapBottom;
+
+    // Останавливаем вертикальное движение
+    ObjectVelocity.y = 0.f;
+
+    return FromTop ? ECollisionSide::ECS_Top : ECollisionSide::ECS_Bottom;
+}
 
 /**
 * @brief Проверяет пересечение двух прямоугольников.
@@ -1,6 +1,9 @@
 ﻿#pragma once
 
-#include "../Enemy/Enemy.h"
+#include "../Bullet/BulletPool.h"
+#include "../Entity/EntityComponentStore.h"
+#include "../Entity/SlotMap.h"
+#include "../Player/Player.h"
 #include "../GameMain/GameState.h"
 #include "../GameObjects/KeyObject.h"
 #include "../GameMap/GameMap.h"
@@ -11,6 +14,35 @@ class AGameState;
 class AKeyObject;
 class AChestObject;
 
+/**
+ * @brief Сторона, с которой актер столкнулся с препятствием.
+ */
+enum class ECollisionSide
+{
+    ECS_None,
+    ECS_Horizontal,
+    ECS_Top,
+    ECS_Bottom
+};
+
+/**
+ * @brief Результат трассировки луча по препятствиям карты.
+ */
+struct RaycastHit
+{
+    sf::Vector2f HitPoint;      // Точка попадания (или конец луча, если препятствий нет)
+    float Distance = 0.f;       // Расстояние от начала луча до точки попадания
+};
+
+/**
+ * @brief Результат проверки движущегося прямоугольника по пути его перемещения.
+ */
+struct SweepHit
+{
+    float TimeOfImpact = 1.f;   // Доля перемещения до касания (0, если прямоугольники пересекались с начала)
+    sf::Vector2f Normal;        // Нормаль поверхности препятствия в точке касания (нулевая, если пересекались с начала)
+};
+
 /**
  * @brief Менеджер коллизий для персонажа и врагов.
  * 
@@ -39,17 +71,22 @@ public:
     /**
      * @brief Проверяет столкновения всех пуль с врагами и игровой картой.
      * 
+     * Пули и враги, уничтоженные за кадр, только помечаются на уничтожение,
+     * в конце кадра пули возвращаются в пул, а враги удаляются из хранилища сущностей.
+     * 
      * @param BulletsVectorPtr Указатель на вектор пуль.
-     * @param EnemyVectorPtr Указатель на вектор врагов.
-     * @param KeysVectorPtr Указатель на вектор ключей.
+     * @param EntityStore Хранилище сущностей врагов.
+     * @param KeySlotMap Карта слотов, которая владеет ключами, в ней создаются ключи, выпавшие из боссов.
+     * @param KeyHandles Дескрипторы ключей, которые ещё не подобраны.
      * @param Player Ссылка на персонажа.
      * @param SpriteManager Ссылка на менеджер спрайтов.
      * @param SoundManager Ссылка на менеджер звуков.
      * @param ParticleSystem Ссылка на менеджер частиц.
      */
     void CheckAllBulletCollisions(std::vector<ABullet*>& BulletsVectorPtr,
-                                  std::vector<AEnemy*>& EnemyVectorPtr,
-                                  std::vector<AKeyObject*>& KeysVectorPtr,
+                                  AEntityComponentStore& EntityStore,
+                                  TSlotMap<AKeyObject>& KeySlotMap,
+                                  std::vector<EntityHandle>& KeyHandles,
                                   APlayer& Player, ASpriteManager& SpriteManager,
                                   ASoundManager& SoundManager, AParticleSystemManager& ParticleSystem) const;
 
@@ -71,39 +108,168 @@ public:
     /**
      * @brief Проверяет столкновение с ключами.
      * 
-     * @param KeysVectorPtr Указатель на вектор ключей.
+     * Подобранные ключи переносятся в вектор найденных ключей, дескрипторы удалённых ключей отбрасываются.
+     *
+     * @param KeySlotMap Карта слотов, которая владеет ключами.
+     * @param KeyHandles Дескрипторы ключей, которые ещё не подобраны.
      * @param SoundManager Ссылка на менеджер звуков.
      */
-    void CheckCollisionWithKey(std::vector<AKeyObject*>& KeysVectorPtr, ASoundManager& SoundManager);
+    void CheckCollisionWithKey(TSlotMap<AKeyObject>& KeySlotMap, std::vector<EntityHandle>& KeyHandles,
+                               ASoundManager& SoundManager);
 
     /**
      * @brief Проверяет столкновение с игровой картой.
      * 
      * @param ActorRect Прямоугольник коллизии актера.
      * @param ObjectVelocity Вектор скорости объекта.
-     * @param EnemyPtr Указатель на врага.
+     * 
+     * @return true, если актер столкнулся с препятствием сбоку (враги при этом разворачиваются).
      */
-    void CheckCollisionWithGameMap(sf::FloatRect& ActorRect, sf::Vector2f& ObjectVelocity, AEnemy* EnemyPtr) const;
+    bool CheckCollisionWithGameMap(sf::FloatRect& ActorRect, sf::Vector2f& ObjectVelocity) const;
  
-private:
     /**
-     * @brief Проверяет столкновение пули с игровой картой.
+     * @brief Проверяет движущийся прямоугольник с неподвижным по пути перемещения (swept AABB).
+     * 
+     * Находит долю перемещения, на которой прямоугольники начинают пересекаться, поэтому быстрые объекты
+     * не проскакивают сквозь тонкие препятствия при большом шаге времени.
+     * 
+     * @param MovingRect Прямоугольник в начале перемещения.
+     * @param Displacement Смещение прямоугольника за кадр.
+     * @param Target Неподвижный прямоугольник.
+     * @param OutHit Время касания и нормаль поверхности Target в точке касания.
+     * 
+     * @return true, если прямоугольники пересекутся во время перемещения, иначе false.
+     */
+    static bool SweepAABB(const sf::FloatRect& MovingRect,
+                          const sf::Vector2f& Displacement,
+                          const sf::FloatRect& Target,
+                          SweepHit& OutHit);
+
+    /**
+     * @brief Проверяет столкновение пули с игровой картой по всему пути пули за кадр.
      * 
      * @param Bullet Пуля для проверки столкновения.
+     * @param OutHit Время касания и нормаль ближайшего препятствия.
      * 
-     * @return true, если есть столкновение с игровой картой, иначе false.
+     * @return true, если пуля столкнулась с препятствием или твёрдым тайлом, иначе false.
      */
-    bool CheckBulletCollisionWithGameMap(AActor& Bullet) const;
-   
+    bool SweepBulletAgainstGameMap(ABullet& Bullet, SweepHit& OutHit) const;
+
     /**
-     * @brief Проверяет столкновение пули с объектом (персонажем или врагом).
+     * @brief Проверяет столкновение пули с пешкой (персонажем или врагом) по всему пути пули за кадр.
      * 
      * @param Bullet Пуля для проверки столкновения.
-     * @param PawnRect Прямоугольник объекта для проверки.
+     * @param PawnRect Прямоугольник пешки.
+     * @param OutHit Время касания и нормаль поверхности пешки.
+     * 
+     * @return true, если пуля задела пешку, иначе false.
+     */
+    bool SweepBulletAgainstPawn(ABullet& Bullet, const sf::FloatRect& PawnRect, SweepHit& OutHit) const;
+
+    /**
+     * @brief Пускает луч от одной точки к другой и ищет первое препятствие на пути.
+     * 
+     * Луч проходит по ячейкам сетки препятствий и по тайлам (DDA) и останавливается на первом препятствии,
+     * поэтому стоимость зависит от длины луча, а не от количества препятствий на карте.
+     * 
+     * @param From Начало луча.
+     * @param To Конец луча.
+     * @param OutHit Точка и расстояние попадания (если попадания нет, точка конца луча).
+     * 
+     * @return true, если луч пересекает препятствие, иначе false.
+     */
+    bool Raycast(const sf::Vector2f& From, const sf::Vector2f& To, RaycastHit& OutHit) const;
+
+private:
+    /**
+     * @brief Пускает луч по ячейкам сетки препятствий карты.
+     * 
+     * @param From Начало луча.
+     * @param To Конец луча.
+     * @param InOutHitFraction Доля пути до ближайшего попадания, уменьшается при нахождении более близкого.
+     * 
+     * @return true, если найдено попадание ближе InOutHitFraction, иначе false.
+     */
+    bool RaycastObstacles(const sf::Vector2f& From, const sf::Vector2f& To, float& InOutHitFraction) const;
+
+    /**
+     * @brief Находит точку входа отрезка в прямоугольник.
+     * 
+     * @param From Начало отрезка.
+     * @param Delta Вектор от начала до конца отрезка.
+     * @param Rect Прямоугольник для проверки.
+     * @param OutEnterFraction Доля пути до точки входа (0, если отрезок начинается внутри).
+     * 
+     * @return true, если отрезок пересекает прямоугольник, иначе false.
+     */
+    static bool IntersectSegmentWithRect(const sf::Vector2f& From,
+                                         const sf::Vector2f& Delta,
+                                         const sf::FloatRect& Rect,
+                                         float& OutEnterFraction);
+
+    /**
+     * @brief Сортирует актеров по левой границе прямоугольника коллизии вставками.
+     * 
+     * Между кадрами актеры смещаются мало и порядок почти не меняется,
+     * поэтому сортировка вставками на таком векторе работает почти за линейное время.
+     * 
+     * @param Actors Вектор указателей на актеров.
+     */
+    template <typename T>
+    static void SortActorsByLeftEdge(std::vector<T*>& Actors);
+
+    /**
+     * @brief Сортирует индексы прямоугольников по их левой границе вставками.
+     * 
+     * Порядок индексов с прошлого кадра почти верный, поэтому сортировка работает почти за линейное время.
+     * 
+     * @param Indices Индексы прямоугольников, отсортированные на прошлом кадре.
+     * @param Rects Прямоугольники коллизий.
+     */
+    static void SortIndicesByLeftEdge(std::vector<uint32_t>& Indices, const std::vector<sf::FloatRect>& Rects);
+
+    /**
+     * @brief Получает прямоугольник, охватывающий весь путь перемещения прямоугольника.
+     * 
+     * @param Rect Прямоугольник в начале перемещения.
+     * @param Displacement Смещение прямоугольника.
      * 
-     * @return true, если есть столкновение с объектом, иначе false.
+     * @return Прямоугольник, охватывающий начальное и конечное положение.
      */
-    bool CheckBulletCollisionWithPawn(AActor& Bullet, const sf::FloatRect& PawnRect) const;
+    static sf::FloatRect GetSweptBounds(const sf::FloatRect& Rect, const sf::Vector2f& Displacement);
+
+    /**
+     * @brief Получает позицию пули в момент касания.
+     * 
+     * @param Bullet Пуля.
+     * @param Hit Результат проверки пули по пути перемещения.
+     * 
+     * @return Позиция пули в момент касания.
+     */
+    static sf::Vector2f GetBulletImpactPosition(const ABullet& Bullet, const SweepHit& Hit);
+
+    /**
+     * @brief Выталкивает прямоугольник из препятствия по оси наименьшего перекрытия.
+     * 
+     * @param Rect Прямоугольник коллизии актера.
+     * @param ObjectVelocity Вектор скорости актера, по оси столкновения скорость обнуляется.
+     * @param Obstacle Прямоугольник препятствия.
+     * 
+     * @return Сторона, с которой произошло столкновение, или ECS_None, если пересечения нет.
+     */
+    ECollisionSide ResolveObstacleOverlap(sf::FloatRect& Rect,
+                                          sf::Vector2f& ObjectVelocity,
+                                          const sf::FloatRect& Obstacle) const;
+
+    /**
+     * @brief Пуля персонажа и её столкновение с картой за кадр, для широкой фазы.
+     */
+    struct BulletSweepEntry
+    {
+        ABullet* Bullet = nullptr;  // Пуля персонажа.
+        bool bHitGameMap = false;   // Столкнулась ли пуля с картой за кадр.
+        SweepHit GameMapHit;        // Время и нормаль столкновения с картой.
+    };
  
 public:
     /**
@@ -127,4 +293,33 @@ private:
     AGameState& GameStateRef;   // Ссылка на объект состояния игры.
     APlayer& PlayerRef;         // Ссылка на объект персонажа.
     AGameMap& GameMapRef;       // Ссылка на объект игровой карты.
+
+    mutable std::vector<uint32_t> ObstacleCandidates;   // Индексы препятствий рядом с актером, переиспользуются между проверками.
+    mutable std::vector<sf::FloatRect> SolidTileCandidates; // Прямоугольники твёрдых тайлов рядом с актером.
+    mutable std::vector<BulletSweepEntry> EnemyChannelBullets; // Пули персонажа, отсортированные по X, для широкой фазы.
+    mutable std::vector<uint32_t> SortedEnemyIndices;   // Индексы врагов, отсортированные по левой границе, для широкой фазы.
 };
+
+/**
+ * @brief Сортирует актеров по левой границе прямоугольника коллизии вставками.
+ * 
+ * @param Actors Вектор указателей на актеров.
+ */
+template <typename T>
+void ACollisionManager::SortActorsByLeftEdge(std::vector<T*>& Actors)
+{
+    for (size_t i = 1; i < Actors.size(); ++i)
+    {
+        T* Actor = Actors[i];
+        const float Left = Actor->GetActorCollisionRect().left;
+
+        size_t j = i;
+        while (j > 0 && Actors[j - 1]->GetActorCollisionRect().left > Left)
+        {
+            Actors[j] = Actors[j - 1];
+            --j;
+        }
+
+        Actors[j] = Actor;
+    }
+}
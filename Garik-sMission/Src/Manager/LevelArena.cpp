@@ -0,0 +1,74 @@
+﻿#include "LevelArena.h"
+#include <algorithm>
+
+/**
+ * @brief Конструктор класса ALevelArena.
+ *
+ * @param NewBlockSize Размер одного блока памяти.
+ */
+ALevelArena::ALevelArena(size_t NewBlockSize)
+    : BlockSize(NewBlockSize)
+{
+}
+
+/**
+ * @brief Деструктор класса ALevelArena, уничтожает оставшиеся объекты и освобождает блоки.
+ */
+ALevelArena::~ALevelArena()
+{
+    ResetArena();
+}
+
+/**
+ * @brief Выделяет память в арене.
+ *
+ * @param Size Размер памяти в байтах.
+ * @param Alignment Выравнивание памяти.
+ *
+ * @return Указатель на выделенную память.
+ */
+void* ALevelArena::Allocate(size_t Size, size_t Alignment)
+{
+    // Ищем блок, в котором хватает места, начиная с текущего; уже заполненные блоки не просматриваются
+    for (; CurrentBlockIndex < Blocks.size(); ++CurrentBlockIndex)
+    {
+        ArenaBlock& Block = Blocks[CurrentBlockIndex];
+
+        const uintptr_t BlockStart = reinterpret_cast<uintptr_t>(Block.Memory.get());
+        const uintptr_t AlignedAddress = (BlockStart + Block.Used + Alignment - 1) & ~(Alignment - 1);
+        const size_t AlignedOffset = AlignedAddress - BlockStart;
+
+        if (AlignedOffset + Size <= Block.Size)
+        {
+            Block.Used = AlignedOffset + Size;
+            return reinterpret_cast<void*>(AlignedAddress);
+        }
+    }
+
+    // Места нет, добавляем новый блок; слишком большой объект получает блок по своему размеру
+    ArenaBlock NewBlock;
+    NewBlock.Size = std::max(BlockSize, Size + Alignment);
+    NewBlock.Memory = std::make_unique<std::byte[]>(NewBlock.Size);
+    Blocks.emplace_back(std::move(NewBlock));
+
+    return Allocate(Size, Alignment);
+}
+
+/**
+ * @brief Уничтожает все объекты арены и делает всю память снова свободной, блоки сохраняются.
+ */
+void ALevelArena::ResetArena()
+{
+    // Объекты уничтожаются в порядке, обратном созданию
+    for (auto It = Destructors.rbegin(); It != Destructors.rend(); ++It)
+    {
+        It->Destroy(It->Object);
+    }
+    Destructors.clear();
+
+    for (ArenaBlock& Block : Blocks)
+    {
+        Block.Used = 0;
+    }
+    CurrentBlockIndex = 0;
+}
@@ -0,0 +1,112 @@
+﻿#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../Constants.h"
+
+/**
+ * @brief Монотонная арена для объектов, которые живут до конца уровня (сундуки, лечащие объекты).
+ *
+ * Объекты размещаются подряд в крупных блоках памяти, отдельного освобождения нет.
+ * Арена сбрасывается при загрузке уровня (AGameState::InitGame): вызываются деструкторы только тех объектов,
+ * у которых они нетривиальны, а блоки не освобождаются, а переиспользуются, поэтому загрузка уровня
+ * не выделяет память повторно и не фрагментирует кучу. Перезапуск уровня объекты арены не пересоздаёт,
+ * они только возвращаются в начальное состояние.
+ */
+class ALevelArena
+{
+public:
+    /**
+     * @brief Конструктор класса ALevelArena.
+     *
+     * @param NewBlockSize Размер одного блока памяти.
+     */
+    explicit ALevelArena(size_t NewBlockSize = LEVEL_ARENA_BLOCK_SIZE);
+
+    /**
+     * @brief Деструктор класса ALevelArena, уничтожает оставшиеся объекты и освобождает блоки.
+     */
+    ~ALevelArena();
+
+    ALevelArena(const ALevelArena&) = delete;
+    ALevelArena& operator=(const ALevelArena&) = delete;
+
+    /**
+     * @brief Создаёт объект в арене.
+     *
+     * Объект нельзя удалять через delete, он уничтожается при сбросе арены.
+     *
+     * @param Args Аргументы конструктора объекта.
+     *
+     * @return Указатель на созданный объект.
+     */
+    template <typename T, typename... ArgsType>
+    T* CreateObject(ArgsType&&... Args);
+
+    /**
+     * @brief Выделяет память в арене.
+     *
+     * @param Size Размер памяти в байтах.
+     * @param Alignment Выравнивание памяти.
+     *
+     * @return Указатель на выделенную память.
+     */
+    void* Allocate(size_t Size, size_t Alignment);
+
+    /**
+     * @brief Уничтожает все объекты арены и делает всю память снова свободной, блоки сохраняются.
+     */
+    void ResetArena();
+
+private:
+    /**
+     * @brief Блок памяти арены.
+     */
+    struct ArenaBlock
+    {
+        std::unique_ptr<std::byte[]> Memory;    // Память блока
+        size_t Size = 0;                        // Размер блока
+        size_t Used = 0;                        // Занятая часть блока
+    };
+
+    /**
+     * @brief Запись об объекте с нетривиальным деструктором.
+     */
+    struct DestructorRecord
+    {
+        void (*Destroy)(void*) = nullptr;       // Функция, вызывающая деструктор объекта
+        void* Object = nullptr;                 // Объект
+    };
+
+    size_t BlockSize;                           // Размер нового блока по умолчанию
+    size_t CurrentBlockIndex = 0;               // Блок, из которого сейчас выделяется память
+    std::vector<ArenaBlock> Blocks;             // Блоки памяти, сохраняются между сбросами
+    std::vector<DestructorRecord> Destructors;  // Объекты, которым нужен вызов деструктора при сбросе
+};
+
+/**
+ * @brief Создаёт объект в арене.
+ *
+ * Объект нельзя удалять через delete, он уничтожается при сбросе арены.
+ *
+ * @param Args Аргументы конструктора объекта.
+ *
+ * @return Указатель на созданный объект.
+ */
+template <typename T, typename... ArgsType>
+T* ALevelArena::CreateObject(ArgsType&&... Args)
+{
+    T* Object = new(Allocate(sizeof(T), alignof(T))) T(std::forward<ArgsType>(Args)...);
+
+    // Объектам без деструктора (простые структуры) запись не нужна, их сброс ничего не стоит
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        Destructors.push_back({[](void* Ptr) { static_cast<T*>(Ptr)->~T(); }, Object});
+    }
+
+    return Object;
+}
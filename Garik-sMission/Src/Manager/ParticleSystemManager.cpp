@@ -1,4 +1,5 @@
 #include "ParticleSystemManager.h"
+#include <algorithm>
 #include <ranges>
 
 /**
@@ -14,8 +15,10 @@ AParticleSystemManager::~AParticleSystemManager()
 * @brief Инициализирует систему частиц.
 * 
 * Этот метод должен быть вызван перед использованием системы частиц.
+* 
+* @param SpriteManager Менеджер спрайтов с кэшем текстур.
 */
-void AParticleSystemManager::InitParticleSystem()
+void AParticleSystemManager::InitParticleSystem(ASpriteManager& SpriteManager)
 {
     // Инициализация эффекта разрушения пули
     AddParticleEffect("BulletDestroy", ASSETS_PATH + "MainTiles/Bullets.png", 10.f,
@@ -26,7 +29,7 @@ void AParticleSystemManager::InitParticleSystem()
                           sf::IntRect(68, 54, 7, 7),
                           sf::IntRect(0, 0, 0, 0),
                           // Пустой кадр, чтобы была иллюзия, что объект уничтожен, а не останавливался на последнем кадре
-                      });
+                      }, SpriteManager);
 
     // Инициализация эффекта взрыва рокеты
     AddParticleEffect("RocketDestroy", ASSETS_PATH + "MainTiles/Bullets.png", 20.f,
@@ -37,14 +40,14 @@ void AParticleSystemManager::InitParticleSystem()
                           sf::IntRect(96, 3, 15, 14),
                           sf::IntRect(114, 3, 11, 13),
                           sf::IntRect(0, 0, 0, 0),
-                      });
+                      }, SpriteManager);
 
     // Инициализация эффекта пламя из дула оружия, после выстрела
     AddParticleEffect("MuzzleFlash", ASSETS_PATH + "MainTiles/Bullets.png", 30.f,
                       {
                           sf::IntRect(51, 70, 4, 8),
                           sf::IntRect(0, 0, 0, 0)
-                      });
+                      }, SpriteManager);
 }
 
 /**
@@ -54,35 +57,21 @@ void AParticleSystemManager::InitParticleSystem()
 * @param TexturePath Путь к текстуре эффекта частиц.
 * @param FrameSpeed Скорость смены кадров анимации.
 * @param Frames Вектор прямоугольников, определяющих кадры анимации.
+* @param SpriteManager Менеджер спрайтов с кэшем текстур.
 */
 void AParticleSystemManager::AddParticleEffect(const std::string& EffectName, const std::string& TexturePath,
-                                               float FrameSpeed, const std::vector<sf::IntRect>& Frames)
+                                               float FrameSpeed, const std::vector<sf::IntRect>& Frames,
+                                               ASpriteManager& SpriteManager)
 {
-    AAnimationManager NewEffect;
-    NewEffect.AnimTexture.loadFromFile(TexturePath);
-    NewEffect.FrameSpeed = FrameSpeed;
-    NewEffect.FrameRect = Frames;
-
-    // Добавляем новый эффект в карту с именем EffectName как ключ
-    ParticleEffectsMap.emplace(EffectName, std::move(NewEffect));
-}
+    ParticleEffectPool& EffectPool = ParticleEffectsMap[EffectName];
+    EffectPool.Clip = SpriteManager.LoadAnimationClip("Particle_" + EffectName, TexturePath, Frames, FrameSpeed);
 
-/**
-* @brief Запускает воспроизведение эффекта частиц.
-* 
-* @param EffectName Название эффекта частиц для воспроизведения.
-*/
-void AParticleSystemManager::PlayEffect(const std::string& EffectName)
-{
-    if (ParticleEffectsMap.contains(EffectName))
-    {
-        ParticleEffectsMap[EffectName].Animation.SetCurrentFrame(0);
-        ParticleEffectsMap[EffectName].Animation.ResetAnimation();
-    }
+    // Резервируем экземпляры заранее, чтобы запуск эффекта не выделял память
+    EffectPool.Instances.reserve(PARTICLE_POOL_CAPACITY);
 }
 
 /**
-* @brief Запускает воспроизведение эффекта частиц с заданной позицией и параметрами.
+* @brief Запускает новый экземпляр эффекта частиц с заданной позицией и параметрами.
 * 
 * @param EffectName Название эффекта частиц для воспроизведения.
 * @param ObjectPosition Позиция объекта, на который нужно отобразить эффект частиц.
@@ -97,57 +86,67 @@ void AParticleSystemManager::PlayEffectWithPosition(const std::string& EffectNam
                                                     bool bIsMoveRight)
 {
     // Проверка на существование эффекта
-    if (ParticleEffectsMap.contains(EffectName))
+    const auto It = ParticleEffectsMap.find(EffectName);
+    if (It == ParticleEffectsMap.end())
     {
-        // Создаем новый эффект
-        ParticleEffect NewEffect;
-
-        // Копируем текстуру и устанавливаем кадры вручную
-        NewEffect.Animation.AnimTexture = ParticleEffectsMap[EffectName].Animation.AnimTexture;
-        NewEffect.Animation.FrameSpeed = ParticleEffectsMap[EffectName].Animation.FrameSpeed;
-        NewEffect.Animation.FrameRect = ParticleEffectsMap[EffectName].Animation.FrameRect;
+        return;
+    }
 
-        // Устанавливаем позицию эффекта с возможным смещением
-        NewEffect.Position = ObjectPosition + Offset;
+    // Если пул эффекта заполнен, новый экземпляр пропускается, чтобы не выделять память
+    if (It->second.Instances.size() >= PARTICLE_POOL_CAPACITY)
+    {
+        return;
+    }
 
-        // Устанавливаем масштаб спрайта
-        // Если персонаж движется влево, отразить спрайт по оси X
-        if (!bIsMoveRight)
-        {
-            NewEffect.Scale = {-EffectScale.x, EffectScale.y}; // Отражаем по X
-        }
-        else
-        {
-            NewEffect.Scale = EffectScale;
-        }
+    ParticleInstance NewInstance;
 
-        // Добавляем эффект в список активных
-        ParticleEffectsMap[EffectName] = std::move(NewEffect);
+    // Устанавливаем позицию эффекта с возможным смещением
+    NewInstance.Position = ObjectPosition + Offset;
 
-        // Сбрасываем анимацию
-        ParticleEffectsMap[EffectName].Animation.SetStopAtLastFrame(true);
+    // Устанавливаем масштаб эффекта
+    // Если персонаж движется влево, отразить эффект по оси X
+    if (!bIsMoveRight)
+    {
+        NewInstance.Scale = {-EffectScale.x, EffectScale.y}; // Отражаем по X
+    }
+    else
+    {
+        NewInstance.Scale = EffectScale;
     }
+
+    // Добавляем экземпляр к уже проигрывающимся, память зарезервирована заранее
+    It->second.Instances.emplace_back(NewInstance);
 }
 
 /**
-* @brief Обновляет систему частиц.
+* @brief Обновляет систему частиц, завершённые экземпляры возвращаются в пул.
 * 
 * @param DeltaTime Время, прошедшее с последнего обновления.
 */
 void AParticleSystemManager::UpdateParticleSystem(float DeltaTime)
 {
-    // TODO: Используется для отладки, сколько эффектов находится в MAP
-    //std::cout << "Active Particle Effects: " << ParticleEffectsMap.size() << std::endl;
-
-    // Проходим по всем активным эффектам и обновляем их
-    for (auto it = ParticleEffectsMap.begin(); it != ParticleEffectsMap.end();)
+    for (ParticleEffectPool& EffectPool : ParticleEffectsMap | std::views::values)
     {
-        it->second.Animation.AnimationUpdate(DeltaTime);
-        ++it; // Переходим к следующему элементу
-    }
+        const AnimationClip& Clip = *EffectPool.Clip;
+        const float FrameCount = static_cast<float>(Clip.Frames.size());
+        std::vector<ParticleInstance>& Instances = EffectPool.Instances;
 
-    // TODO: Используется для отладки, сколько эффектов находится в MAP
-    //std::cout << "Active Particle Effects after update: " << ParticleEffectsMap.size() << std::endl;
+        for (size_t i = 0; i < Instances.size();)
+        {
+            Instances[i].FrameIndex += Clip.FrameSpeed * DeltaTime;
+
+            // Эффект проиграл все кадры, на его место ставим последний активный экземпляр
+            if (Instances[i].FrameIndex >= FrameCount)
+            {
+                Instances[i] = Instances.back();
+                Instances.pop_back();
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
 }
 
 /**
@@ -157,30 +156,77 @@ void AParticleSystemManager::UpdateParticleSystem(float DeltaTime)
 */
 void AParticleSystemManager::DrawParticleSystem(sf::RenderWindow& Window)
 {
-    for (auto& Effect : ParticleEffectsMap | std::views::values)
+    // Вершины пакетов очищаются, но память массивов сохраняется между кадрами
+    for (ParticleBatch& Batch : ParticleBatches)
     {
-        // Отрисовываем эффект на экране
-        sf::Sprite Sprite;
-        Sprite.setTexture(Effect.Animation.AnimTexture);
-        Sprite.setTextureRect(Effect.Animation.GetCurrentFrame());
-        Sprite.setPosition(Effect.Position);
-        Sprite.setScale(Effect.Scale);
-
-        Window.draw(Sprite);
+        Batch.Vertices.clear();
+    }
+
+    for (const ParticleEffectPool& EffectPool : ParticleEffectsMap | std::views::values)
+    {
+        if (EffectPool.Instances.empty())
+        {
+            continue;
+        }
+
+        // Находим пакет текстуры эффекта, текстур немного, поэтому достаточно линейного поиска
+        const sf::Texture* Texture = EffectPool.Clip->Texture.get();
+        auto BatchIt = std::find_if(ParticleBatches.begin(), ParticleBatches.end(), [Texture](const ParticleBatch& Batch)
+        {
+            return Batch.Texture == Texture;
+        });
+        if (BatchIt == ParticleBatches.end())
+        {
+            ParticleBatches.emplace_back();
+            BatchIt = std::prev(ParticleBatches.end());
+            BatchIt->Texture = Texture;
+        }
+
+        for (const ParticleInstance& Instance : EffectPool.Instances)
+        {
+            const sf::IntRect& Frame = EffectPool.Clip->Frames[static_cast<size_t>(Instance.FrameIndex)];
+
+            // Как у sf::Sprite: позиция задаёт левый верхний угол, отрицательный масштаб отражает кадр от позиции
+            const sf::Vector2f FrameSize = {
+                static_cast<float>(Frame.width) * Instance.Scale.x,
+                static_cast<float>(Frame.height) * Instance.Scale.y
+            };
+            const float TexLeft = static_cast<float>(Frame.left);
+            const float TexTop = static_cast<float>(Frame.top);
+            const float TexRight = static_cast<float>(Frame.left + Frame.width);
+            const float TexBottom = static_cast<float>(Frame.top + Frame.height);
+
+            const sf::Vertex TopLeft(Instance.Position, {TexLeft, TexTop});
+            const sf::Vertex TopRight(Instance.Position + sf::Vector2f(FrameSize.x, 0.f), {TexRight, TexTop});
+            const sf::Vertex BottomRight(Instance.Position + FrameSize, {TexRight, TexBottom});
+            const sf::Vertex BottomLeft(Instance.Position + sf::Vector2f(0.f, FrameSize.y), {TexLeft, TexBottom});
+
+            BatchIt->Vertices.append(TopLeft);
+            BatchIt->Vertices.append(TopRight);
+            BatchIt->Vertices.append(BottomRight);
+            BatchIt->Vertices.append(TopLeft);
+            BatchIt->Vertices.append(BottomRight);
+            BatchIt->Vertices.append(BottomLeft);
+        }
+    }
+
+    // Один вызов отрисовки на текстуру, независимо от количества экземпляров
+    for (const ParticleBatch& Batch : ParticleBatches)
+    {
+        if (Batch.Vertices.getVertexCount() > 0)
+        {
+            Window.draw(Batch.Vertices, Batch.Texture);
+        }
     }
 }
 
 /**
-* @brief Проверяет, завершен ли эффект частиц.
-* 
-* @param EffectName Название эффекта частиц для проверки.
-* @return true, если эффект завершен, иначе false.
+* @brief Удаляет все активные экземпляры эффектов, клипы эффектов остаются.
 */
-bool AParticleSystemManager::IsEffectFinished(const std::string& EffectName) const
+void AParticleSystemManager::ClearParticleEffects()
 {
-    if (ParticleEffectsMap.contains(EffectName))
+    for (ParticleEffectPool& EffectPool : ParticleEffectsMap | std::views::values)
     {
-        return ParticleEffectsMap.at(EffectName).Animation.IsAnimationFinished();
+        EffectPool.Instances.clear();
     }
-    return true;
-}
\ No newline at end of file
+}
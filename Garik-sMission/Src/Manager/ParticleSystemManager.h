@@ -1,24 +1,37 @@
 #pragma once
 #include <unordered_map>
-#include "AnimationManager.h"
+#include "SpriteManager.h"
 
 /**
- * @brief Структура для хранения информации о частицах.
- * 
- * Хранит анимацию, позицию и масштаб эффекта частиц.
+ * @brief Структура для хранения одного экземпляра эффекта частиц.
+ *
+ * Хранит только состояние воспроизведения, позицию и масштаб, кадры и текстура берутся из клипа эффекта.
  */
-struct ParticleEffect
+struct ParticleInstance
 {
-    AAnimationManager Animation;    // Менеджер анимации для эффекта частиц.
     sf::Vector2f Position;          // Позиция эффекта частиц на экране.
-    sf::Vector2f Scale;             // Масштаб эффекта частиц.
+    sf::Vector2f Scale;             // Масштаб эффекта частиц, отрицательный X отражает эффект.
+    float FrameIndex = 0.f;         // Текущий индекс кадра анимации.
+};
+
+/**
+ * @brief Пул экземпляров одного эффекта частиц.
+ *
+ * Все экземпляры эффекта используют один общий клип анимации.
+ * Активные экземпляры лежат в начале массива подряд, завершённые заменяются последним активным.
+ */
+struct ParticleEffectPool
+{
+    const AnimationClip* Clip = nullptr;        // Общий клип эффекта (текстура, кадры и скорость).
+    std::vector<ParticleInstance> Instances;    // Активные экземпляры эффекта.
 };
 
 /**
  * @brief Менеджер системы частиц.
- * 
+ *
  * Класс AParticleSystemManager управляет эффектами частиц, включая их добавление, воспроизведение,
- * обновление и отрисовку.
+ * обновление и отрисовку. Каждый эффект может проигрываться в любом количестве экземпляров одновременно,
+ * запуск экземпляра не выделяет память, а все экземпляры с одной текстурой рисуются одним массивом вершин.
  */
 class AParticleSystemManager
 {
@@ -36,32 +49,30 @@ public:
 
     /**
      * @brief Инициализирует систему частиц.
-     * 
+     *
      * Этот метод должен быть вызван перед использованием системы частиц.
+     *
+     * @param SpriteManager Менеджер спрайтов с кэшем текстур.
      */
-    void InitParticleSystem();
+    void InitParticleSystem(ASpriteManager& SpriteManager);
 
     /**
      * @brief Добавляет новый эффект частиц в систему.
-     * 
+     *
      * @param EffectName Название эффекта частиц.
      * @param TexturePath Путь к текстуре эффекта частиц.
      * @param FrameSpeed Скорость смены кадров анимации.
      * @param Frames Вектор прямоугольников, определяющих кадры анимации.
+     * @param SpriteManager Менеджер спрайтов с кэшем текстур.
      */
     void AddParticleEffect(const std::string& EffectName, const std::string& TexturePath, float FrameSpeed,
-                           const std::vector<sf::IntRect>& Frames);
-
-    /**
-     * @brief Запускает воспроизведение эффекта частиц.
-     * 
-     * @param EffectName Название эффекта частиц для воспроизведения.
-     */
-    void PlayEffect(const std::string& EffectName);
+                           const std::vector<sf::IntRect>& Frames, ASpriteManager& SpriteManager);
 
     /**
-     * @brief Запускает воспроизведение эффекта частиц с заданной позицией и параметрами.
-     * 
+     * @brief Запускает новый экземпляр эффекта частиц с заданной позицией и параметрами.
+     *
+     * Уже проигрывающиеся экземпляры этого эффекта продолжают воспроизведение.
+     *
      * @param EffectName Название эффекта частиц для воспроизведения.
      * @param ObjectPosition Позиция объекта, на который нужно отобразить эффект частиц.
      * @param Offset Смещение эффекта частиц относительно позиции объекта.
@@ -75,27 +86,36 @@ public:
                                 bool bIsMoveRight = true);
 
     /**
-     * @brief Обновляет систему частиц.
-     * 
+     * @brief Обновляет систему частиц, завершённые экземпляры возвращаются в пул.
+     *
      * @param DeltaTime Время, прошедшее с последнего обновления.
      */
     void UpdateParticleSystem(float DeltaTime);
 
     /**
      * @brief Отрисовывает эффекты частиц на экране.
-     * 
+     *
+     * Экземпляры всех эффектов собираются в один массив вершин на текстуру.
+     *
      * @param Window Окно, на котором будут отрисованы эффекты частиц.
      */
     void DrawParticleSystem(sf::RenderWindow& Window);
 
     /**
-     * @brief Проверяет, завершен ли эффект частиц.
-     * 
-     * @param EffectName Название эффекта частиц для проверки.
-     * @return true, если эффект завершен, иначе false.
+     * @brief Удаляет все активные экземпляры эффектов, клипы эффектов остаются.
      */
-    bool IsEffectFinished(const std::string& EffectName) const;
+    void ClearParticleEffects();
 
 private:
-    std::unordered_map<std::string, ParticleEffect> ParticleEffectsMap; // Хранение анимаций по именам.
+    /**
+     * @brief Пакет экземпляров эффектов с одной текстурой.
+     */
+    struct ParticleBatch
+    {
+        const sf::Texture* Texture = nullptr;           // Текстура пакета
+        sf::VertexArray Vertices{sf::Triangles};        // Вершины экземпляров пакета
+    };
+
+    std::unordered_map<std::string, ParticleEffectPool> ParticleEffectsMap; // Пулы экземпляров эффектов по именам.
+    std::vector<ParticleBatch> ParticleBatches;         // Пакеты отрисовки, переиспользуются между кадрами.
 };
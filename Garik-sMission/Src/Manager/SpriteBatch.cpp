@@ -0,0 +1,215 @@
+﻿#include "SpriteBatch.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Начинает новый кадр, вершины пакетов очищаются, но их память сохраняется.
+ */
+void ASpriteBatch::BeginBatch()
+{
+    for (RenderBatch& Batch : RenderBatches)
+    {
+        Batch.Vertices.clear();
+    }
+}
+
+/**
+ * @brief Добавляет спрайт с учётом его позиции, масштаба, поворота, прямоугольника текстуры и цвета.
+ *
+ * Спрайт без текстуры пропускается.
+ *
+ * @param Sprite Спрайт.
+ * @param Layer Слой отрисовки.
+ */
+void ASpriteBatch::AddSprite(const sf::Sprite& Sprite, ERenderLayer Layer)
+{
+    const sf::Texture* Texture = Sprite.getTexture();
+    if (!Texture)
+    {
+        return;
+    }
+
+    // Как у sf::Sprite: локальный размер берётся по модулю, а отрицательный прямоугольник текстуры отражает кадр
+    const sf::IntRect& TextureRect = Sprite.getTextureRect();
+    const sf::Vector2f LocalSize = {
+        static_cast<float>(std::abs(TextureRect.width)),
+        static_cast<float>(std::abs(TextureRect.height))
+    };
+
+    AppendTransformedQuad(GetBatchVertices(Layer, Texture), Sprite.getTransform(), LocalSize,
+                          sf::FloatRect(TextureRect), Sprite.getColor());
+}
+
+/**
+ * @brief Добавляет прямоугольник текстуры, выровненный по осям.
+ *
+ * @param Texture Текстура.
+ * @param Rect Прямоугольник на экране.
+ * @param TextureRect Прямоугольник текстуры.
+ * @param bFlipX Отразить текстуру по X.
+ * @param Layer Слой отрисовки.
+ */
+void ASpriteBatch::AddQuad(const sf::Texture& Texture, const sf::FloatRect& Rect, const sf::IntRect& TextureRect,
+                           bool bFlipX, ERenderLayer Layer)
+{
+    AppendQuad(GetBatchVertices(Layer, &Texture), Rect, TextureRect, bFlipX, sf::Color::White);
+}
+
+/**
+ * @brief Добавляет однотонный прямоугольник, выровненный по осям.
+ *
+ * @param Rect Прямоугольник на экране.
+ * @param Color Цвет прямоугольника.
+ * @param Layer Слой отрисовки.
+ */
+void ASpriteBatch::AddSolidQuad(const sf::FloatRect& Rect, const sf::Color& Color, ERenderLayer Layer)
+{
+    AppendQuad(GetBatchVertices(Layer, nullptr), Rect, {}, false, Color);
+}
+
+/**
+ * @brief Добавляет однотонный прямоугольник фигуры с учётом её трансформации и цвета заливки.
+ *
+ * @param Shape Фигура.
+ * @param Layer Слой отрисовки.
+ */
+void ASpriteBatch::AddSolidRectangle(const sf::RectangleShape& Shape, ERenderLayer Layer)
+{
+    AppendTransformedQuad(GetBatchVertices(Layer, nullptr), Shape.getTransform(), Shape.getSize(), {},
+                          Shape.getFillColor());
+}
+
+/**
+ * @brief Отрисовывает все непустые пакеты по одному вызову отрисовки на пакет.
+ *
+ * @param Target Цель отрисовки.
+ */
+void ASpriteBatch::FlushBatch(sf::RenderTarget& Target)
+{
+    // Пакеты уже отсортированы по слою и текстуре, поэтому рисуются в порядке хранения
+    for (const RenderBatch& Batch : RenderBatches)
+    {
+        if (Batch.Vertices.getVertexCount() > 0)
+        {
+            Target.draw(Batch.Vertices, sf::RenderStates(Batch.Texture));
+        }
+    }
+}
+
+/**
+ * @brief Находит пакет слоя и текстуры, при отсутствии вставляет его с сохранением сортировки.
+ *
+ * @param Layer Слой отрисовки.
+ * @param Texture Текстура пакета.
+ *
+ * @return Массив вершин пакета.
+ */
+sf::VertexArray& ASpriteBatch::GetBatchVertices(ERenderLayer Layer, const sf::Texture* Texture)
+{
+    // Пакеты без текстуры идут в слое первыми, остальные упорядочены по первому использованию текстуры,
+    // а не по её адресу, который меняется от запуска к запуску
+    const uint32_t TextureOrder = GetTextureOrder(Texture);
+    auto BatchIt = std::lower_bound(RenderBatches.begin(), RenderBatches.end(), std::make_pair(Layer, TextureOrder),
+                                    [](const RenderBatch& Batch, const std::pair<ERenderLayer, uint32_t>& Key)
+                                    {
+                                        if (Batch.Layer != Key.first)
+                                        {
+                                            return Batch.Layer < Key.first;
+                                        }
+                                        return Batch.TextureOrder < Key.second;
+                                    });
+
+    if (BatchIt == RenderBatches.end() || BatchIt->Layer != Layer || BatchIt->TextureOrder != TextureOrder)
+    {
+        BatchIt = RenderBatches.insert(BatchIt, {Layer, Texture, TextureOrder, sf::VertexArray(sf::Triangles)});
+    }
+
+    return BatchIt->Vertices;
+}
+
+/**
+ * @brief Получение порядкового номера текстуры, текстура получает номер при первом использовании.
+ *
+ * @param Texture Текстура пакета.
+ *
+ * @return Номер текстуры, 0 для пакета без текстуры.
+ */
+uint32_t ASpriteBatch::GetTextureOrder(const sf::Texture* Texture)
+{
+    if (!Texture)
+    {
+        return 0;
+    }
+
+    // Номер сохраняется между кадрами, поэтому порядок пакетов зависит только от порядка добавления спрайтов
+    return TextureOrders.try_emplace(Texture, static_cast<uint32_t>(TextureOrders.size() + 1)).first->second;
+}
+
+/**
+ * @brief Добавляет прямоугольник из двух треугольников в массив вершин.
+ *
+ * @param Vertices Массив вершин.
+ * @param Rect Прямоугольник на экране.
+ * @param TextureRect Прямоугольник текстуры.
+ * @param bFlipX Отразить текстуру по X.
+ * @param Color Цвет вершин.
+ */
+void ASpriteBatch::AppendQuad(sf::VertexArray& Vertices, const sf::FloatRect& Rect, const sf::IntRect& TextureRect,
+                              bool bFlipX, const sf::Color& Color)
+{
+    const float Left = Rect.left;
+    const float Top = Rect.top;
+    const float Right = Rect.left + Rect.width;
+    const float Bottom = Rect.top + Rect.height;
+
+    float TexLeft = static_cast<float>(TextureRect.left);
+    float TexRight = static_cast<float>(TextureRect.left + TextureRect.width);
+    const float TexTop = static_cast<float>(TextureRect.top);
+    const float TexBottom = static_cast<float>(TextureRect.top + TextureRect.height);
+
+    if (bFlipX)
+    {
+        std::swap(TexLeft, TexRight);
+    }
+
+    const sf::Vertex TopLeft({Left, Top}, Color, {TexLeft, TexTop});
+    const sf::Vertex TopRight({Right, Top}, Color, {TexRight, TexTop});
+    const sf::Vertex BottomRight({Right, Bottom}, Color, {TexRight, TexBottom});
+    const sf::Vertex BottomLeft({Left, Bottom}, Color, {TexLeft, TexBottom});
+
+    Vertices.append(TopLeft);
+    Vertices.append(TopRight);
+    Vertices.append(BottomRight);
+    Vertices.append(TopLeft);
+    Vertices.append(BottomRight);
+    Vertices.append(BottomLeft);
+}
+
+/**
+ * @brief Добавляет прямоугольник локальных координат, преобразованный трансформацией, в массив вершин.
+ *
+ * @param Vertices Массив вершин.
+ * @param Transform Трансформация объекта.
+ * @param Size Размер прямоугольника в локальных координатах.
+ * @param TextureRect Прямоугольник текстуры.
+ * @param Color Цвет вершин.
+ */
+void ASpriteBatch::AppendTransformedQuad(sf::VertexArray& Vertices, const sf::Transform& Transform,
+                                         const sf::Vector2f& Size, const sf::FloatRect& TextureRect,
+                                         const sf::Color& Color)
+{
+    const float TexRight = TextureRect.left + TextureRect.width;
+    const float TexBottom = TextureRect.top + TextureRect.height;
+
+    const sf::Vertex TopLeft(Transform.transformPoint(0.f, 0.f), Color, {TextureRect.left, TextureRect.top});
+    const sf::Vertex TopRight(Transform.transformPoint(Size.x, 0.f), Color, {TexRight, TextureRect.top});
+    const sf::Vertex BottomRight(Transform.transformPoint(Size.x, Size.y), Color, {TexRight, TexBottom});
+    const sf::Vertex BottomLeft(Transform.transformPoint(0.f, Size.y), Color, {TextureRect.left, TexBottom});
+
+    Vertices.append(TopLeft);
+    Vertices.append(TopRight);
+    Vertices.append(BottomRight);
+    Vertices.append(TopLeft);
+    Vertices.append(BottomRight);
+    Vertices.append(BottomLeft);
+}
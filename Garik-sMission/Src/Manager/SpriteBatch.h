@@ -0,0 +1,148 @@
+﻿#pragma once
+#include <unordered_map>
+#include "../Constants.h"
+
+/**
+ * @brief Слой отрисовки пакета спрайтов, слои рисуются в порядке объявления.
+ */
+enum class ERenderLayer : uint8_t
+{
+    ERL_Objects,        // Объекты уровня (сундуки, ворота, ключи на карте, лечащие объекты)
+    ERL_Characters,     // Персонаж и враги
+    ERL_HealthBars,     // Шкалы здоровья врагов
+    ERL_Bullets,        // Пули
+    ERL_HUD             // Интерфейс поверх уровня (шкала здоровья персонажа, текст миссии, найденные ключи)
+};
+
+/**
+ * @brief Пакетная отрисовка спрайтов и однотонных прямоугольников.
+ *
+ * За кадр все спрайты собираются в массивы вершин по одному на пару (слой, текстура), однотонные прямоугольники
+ * попадают в пакет слоя без текстуры. Пакеты отсортированы по слою, а внутри слоя по текстуре, поэтому
+ * количество вызовов отрисовки зависит от количества текстур, а не от количества объектов.
+ * Внутри слоя пакет без текстуры рисуется первым, а пакеты с текстурами - в порядке первого использования
+ * текстуры, поэтому порядок отрисовки пересекающихся объектов одинаков от запуска к запуску.
+ */
+class ASpriteBatch
+{
+public:
+    /**
+     * @brief Конструктор класса ASpriteBatch.
+     */
+    ASpriteBatch() = default;
+
+    /**
+     * @brief Деструктор класса ASpriteBatch.
+     */
+    ~ASpriteBatch() = default;
+
+    /**
+     * @brief Начинает новый кадр, вершины пакетов очищаются, но их память сохраняется.
+     */
+    void BeginBatch();
+
+    /**
+     * @brief Добавляет спрайт с учётом его позиции, масштаба, поворота, прямоугольника текстуры и цвета.
+     *
+     * Спрайт без текстуры пропускается.
+     *
+     * @param Sprite Спрайт.
+     * @param Layer Слой отрисовки.
+     */
+    void AddSprite(const sf::Sprite& Sprite, ERenderLayer Layer);
+
+    /**
+     * @brief Добавляет прямоугольник текстуры, выровненный по осям.
+     *
+     * @param Texture Текстура.
+     * @param Rect Прямоугольник на экране.
+     * @param TextureRect Прямоугольник текстуры.
+     * @param bFlipX Отразить текстуру по X.
+     * @param Layer Слой отрисовки.
+     */
+    void AddQuad(const sf::Texture& Texture, const sf::FloatRect& Rect, const sf::IntRect& TextureRect,
+                 bool bFlipX, ERenderLayer Layer);
+
+    /**
+     * @brief Добавляет однотонный прямоугольник, выровненный по осям.
+     *
+     * @param Rect Прямоугольник на экране.
+     * @param Color Цвет прямоугольника.
+     * @param Layer Слой отрисовки.
+     */
+    void AddSolidQuad(const sf::FloatRect& Rect, const sf::Color& Color, ERenderLayer Layer);
+
+    /**
+     * @brief Добавляет однотонный прямоугольник фигуры с учётом её трансформации и цвета заливки.
+     *
+     * @param Shape Фигура.
+     * @param Layer Слой отрисовки.
+     */
+    void AddSolidRectangle(const sf::RectangleShape& Shape, ERenderLayer Layer);
+
+    /**
+     * @brief Отрисовывает все непустые пакеты по одному вызову отрисовки на пакет.
+     *
+     * @param Target Цель отрисовки.
+     */
+    void FlushBatch(sf::RenderTarget& Target);
+
+    /**
+     * @brief Добавляет прямоугольник из двух треугольников в массив вершин.
+     *
+     * @param Vertices Массив вершин.
+     * @param Rect Прямоугольник на экране.
+     * @param TextureRect Прямоугольник текстуры.
+     * @param bFlipX Отразить текстуру по X.
+     * @param Color Цвет вершин.
+     */
+    static void AppendQuad(sf::VertexArray& Vertices, const sf::FloatRect& Rect, const sf::IntRect& TextureRect,
+                           bool bFlipX, const sf::Color& Color);
+
+private:
+    /**
+     * @brief Пакет вершин одного слоя с одной текстурой.
+     */
+    struct RenderBatch
+    {
+        ERenderLayer Layer = ERenderLayer::ERL_Objects;     // Слой пакета
+        const sf::Texture* Texture = nullptr;               // Текстура пакета, nullptr для однотонных прямоугольников
+        uint32_t TextureOrder = 0;                          // Порядок первого использования текстуры, 0 без текстуры
+        sf::VertexArray Vertices{sf::Triangles};            // Вершины пакета
+    };
+
+    /**
+     * @brief Находит пакет слоя и текстуры, при отсутствии вставляет его с сохранением сортировки.
+     *
+     * @param Layer Слой отрисовки.
+     * @param Texture Текстура пакета.
+     *
+     * @return Массив вершин пакета.
+     */
+    sf::VertexArray& GetBatchVertices(ERenderLayer Layer, const sf::Texture* Texture);
+
+    /**
+     * @brief Добавляет прямоугольник локальных координат, преобразованный трансформацией, в массив вершин.
+     *
+     * @param Vertices Массив вершин.
+     * @param Transform Трансформация объекта.
+     * @param Size Размер прямоугольника в локальных координатах.
+     * @param TextureRect Прямоугольник текстуры.
+     * @param Color Цвет вершин.
+     */
+    static void AppendTransformedQuad(sf::VertexArray& Vertices, const sf::Transform& Transform,
+                                      const sf::Vector2f& Size, const sf::FloatRect& TextureRect,
+                                      const sf::Color& Color);
+
+    /**
+     * @brief Получение порядкового номера текстуры, текстура получает номер при первом использовании.
+     *
+     * @param Texture Текстура пакета.
+     *
+     * @return Номер текстуры, 0 для пакета без текстуры.
+     */
+    uint32_t GetTextureOrder(const sf::Texture* Texture);
+
+    std::vector<RenderBatch> RenderBatches;     // Пакеты, отсортированные по слою и текстуре, переиспользуются между кадрами
+    std::unordered_map<const sf::Texture*, uint32_t> TextureOrders; // Номера текстур в порядке первого использования
+};
@@ -1,6 +1,133 @@
 ﻿// ReSharper disable CppMemberFunctionMayBeStatic
 #include "SpriteManager.h"
 
+/**
+ * @brief Загружает таблицу атласа текстур, листы из неё будут выдаваться страницами атласа.
+ *
+ * Если атлас ещё не собран, все листы загружаются отдельными текстурами.
+ *
+ * @param AtlasTablePath Путь к таблице атласа.
+ */
+void ASpriteManager::InitTextureAtlas(const std::string& AtlasTablePath)
+{
+    TextureAtlas.LoadTextureAtlas(AtlasTablePath);
+}
+
+/**
+ * @brief Получение текстуры из кэша, при первом запросе текстура загружается из файла.
+ *
+ * Для листа из атласа возвращается текстура страницы атласа, на которой он лежит.
+ *
+ * @param TexturePath Путь к текстуре.
+ *
+ * @return Общий указатель на текстуру.
+ */
+TextureHandle ASpriteManager::LoadTexture(const std::string& TexturePath)
+{
+    // Все листы одной страницы атласа получают одну текстуру, поэтому рисуются одним пакетом
+    if (const AtlasRegion* Region = TextureAtlas.FindAtlasRegion(TexturePath))
+    {
+        return LoadTexture(TextureAtlas.GetAtlasPagePath(Region->PageIndex));
+    }
+
+    // Текстура уже загружена, отдаём ещё одну ссылку на неё
+    if (const auto It = TextureCache.find(TexturePath); It != TextureCache.end())
+    {
+        return It->second;
+    }
+
+    auto NewTexture = std::make_shared<sf::Texture>();
+    if (!NewTexture->loadFromFile(TexturePath))
+    {
+        throw std::runtime_error("Error: Failed to load texture: " + TexturePath);
+    }
+
+    TextureCache.emplace(TexturePath, NewTexture);
+    return NewTexture;
+}
+
+/**
+ * @brief Получение прямоугольника всего листа на его текстуре.
+ *
+ * @param TexturePath Путь к текстуре листа.
+ *
+ * @return Область листа на странице атласа или вся текстура, если лист не в атласе.
+ */
+sf::IntRect ASpriteManager::GetTextureRegion(const std::string& TexturePath)
+{
+    if (const AtlasRegion* Region = TextureAtlas.FindAtlasRegion(TexturePath))
+    {
+        return Region->Rect;
+    }
+
+    const sf::Vector2u TextureSize = LoadTexture(TexturePath)->getSize();
+    return {0, 0, static_cast<int>(TextureSize.x), static_cast<int>(TextureSize.y)};
+}
+
+/**
+ * @brief Переводит прямоугольник кадра из координат листа в координаты его текстуры.
+ *
+ * @param TexturePath Путь к текстуре листа.
+ * @param LocalRect Прямоугольник кадра на листе.
+ *
+ * @return Прямоугольник кадра на странице атласа или исходный прямоугольник, если лист не в атласе.
+ */
+sf::IntRect ASpriteManager::ResolveTextureRect(const std::string& TexturePath, const sf::IntRect& LocalRect) const
+{
+    const AtlasRegion* Region = TextureAtlas.FindAtlasRegion(TexturePath);
+    if (!Region)
+    {
+        return LocalRect;
+    }
+
+    // Размер (и знак размера, отражающий кадр) сохраняется, смещается только начало кадра
+    return {LocalRect.left + Region->Rect.left, LocalRect.top + Region->Rect.top, LocalRect.width, LocalRect.height};
+}
+
+/**
+ * @brief Удаляет из кэша текстуры, которые больше не используются ни одним объектом.
+ */
+void ASpriteManager::ReleaseUnusedTextures()
+{
+    // Если ссылка осталась только у кэша, текстура никому не нужна
+    std::erase_if(TextureCache, [](const auto& CachedTexture)
+    {
+        return CachedTexture.second.use_count() == 1;
+    });
+}
+
+/**
+ * @brief Получение клипа анимации из библиотеки, при первом запросе клип создаётся.
+ *
+ * @param ClipName Уникальное имя клипа.
+ * @param TexturePath Путь к текстуре клипа.
+ * @param Frames Прямоугольники кадров на листе.
+ * @param FrameSpeed Скорость смены кадров.
+ *
+ * @return Указатель на клип анимации.
+ */
+const AnimationClip* ASpriteManager::LoadAnimationClip(const std::string& ClipName, const std::string& TexturePath,
+                                                       const std::vector<sf::IntRect>& Frames, float FrameSpeed)
+{
+    // Клип уже создан (например, при повторной инициализации уровня), кадры заново не копируются
+    if (const auto It = AnimationClipLibrary.find(ClipName); It != AnimationClipLibrary.end())
+    {
+        return &It->second;
+    }
+
+    AnimationClip NewClip;
+    NewClip.Texture = LoadTexture(TexturePath);
+    NewClip.Frames.reserve(Frames.size());
+    for (const sf::IntRect& Frame : Frames)
+    {
+        NewClip.Frames.push_back(ResolveTextureRect(TexturePath, Frame));
+    }
+    NewClip.FrameSpeed = FrameSpeed;
+
+    // Элементы unordered_map не перемещаются при вставке, поэтому указатель на клип остаётся действительным
+    return &AnimationClipLibrary.emplace(ClipName, std::move(NewClip)).first->second;
+}
+
 /**
  * @brief Устанавливает размер спрайта с заданными шириной и высотой.
  *
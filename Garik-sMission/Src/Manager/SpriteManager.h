@@ -1,13 +1,101 @@
 ﻿#pragma once
+#include <memory>
+#include <unordered_map>
+#include <vector>
 #include "../Constants.h"
+#include "TextureAtlas.h"
 
+/**
+ * @brief Общая текстура из кэша. Текстура живёт, пока на неё есть хотя бы один указатель.
+ */
+using TextureHandle = std::shared_ptr<const sf::Texture>;
+
+/**
+ * @brief Неизменяемый клип анимации: общая текстура, таблица кадров и скорость смены кадров.
+ *
+ * Клип хранится один раз в библиотеке клипов менеджера спрайтов,
+ * экземпляры анимации ссылаются на него и хранят только своё состояние воспроизведения.
+ */
+struct AnimationClip
+{
+    TextureHandle Texture;                  // Общая текстура клипа из кэша
+    std::vector<sf::IntRect> Frames;        // Прямоугольники кадров на текстуре
+    float FrameSpeed = 0.f;                 // Скорость смены кадров (кадров в секунду)
+};
 
 /**
  * @brief Класс ASpriteManager предоставляет методы для управления размерами и ориентацией спрайтов и форм SFML.
+ *
+ * Также хранит кэш текстур: каждый файл загружается с диска и в видеопамять один раз,
+ * а все объекты с этой текстурой получают общий указатель со счётчиком ссылок.
+ * Рядом хранится библиотека клипов анимации, каждый клип создаётся один раз по имени.
+ * Если собран атлас текстур, листы из него выдаются общей текстурой страницы атласа,
+ * а прямоугольники кадров листа переводятся в координаты страницы через ResolveTextureRect.
  */
 class ASpriteManager
 {
 public:
+    /**
+     * @brief Загружает таблицу атласа текстур, листы из неё будут выдаваться страницами атласа.
+     * 
+     * Если атлас ещё не собран, все листы загружаются отдельными текстурами.
+     * 
+     * @param AtlasTablePath Путь к таблице атласа.
+     */
+    void InitTextureAtlas(const std::string& AtlasTablePath);
+
+    /**
+     * @brief Получение текстуры из кэша, при первом запросе текстура загружается из файла.
+     * 
+     * Для листа из атласа возвращается текстура страницы атласа, на которой он лежит.
+     * 
+     * @param TexturePath Путь к текстуре.
+     * 
+     * @return Общий указатель на текстуру.
+     */
+    TextureHandle LoadTexture(const std::string& TexturePath);
+
+    /**
+     * @brief Получение прямоугольника всего листа на его текстуре.
+     * 
+     * @param TexturePath Путь к текстуре листа.
+     * 
+     * @return Область листа на странице атласа или вся текстура, если лист не в атласе.
+     */
+    sf::IntRect GetTextureRegion(const std::string& TexturePath);
+
+    /**
+     * @brief Переводит прямоугольник кадра из координат листа в координаты его текстуры.
+     * 
+     * @param TexturePath Путь к текстуре листа.
+     * @param LocalRect Прямоугольник кадра на листе.
+     * 
+     * @return Прямоугольник кадра на странице атласа или исходный прямоугольник, если лист не в атласе.
+     */
+    sf::IntRect ResolveTextureRect(const std::string& TexturePath, const sf::IntRect& LocalRect) const;
+
+    /**
+     * @brief Удаляет из кэша текстуры, которые больше не используются ни одним объектом.
+     */
+    void ReleaseUnusedTextures();
+
+    /**
+     * @brief Получение клипа анимации из библиотеки, при первом запросе клип создаётся.
+     * 
+     * Клип с таким именем создаётся один раз, при повторных запросах параметры кадров не используются.
+     * Клипы живут до уничтожения менеджера спрайтов, поэтому указатель на клип можно хранить.
+     * Кадры задаются в координатах листа и хранятся в координатах текстуры клипа.
+     * 
+     * @param ClipName Уникальное имя клипа.
+     * @param TexturePath Путь к текстуре клипа.
+     * @param Frames Прямоугольники кадров на листе.
+     * @param FrameSpeed Скорость смены кадров.
+     * 
+     * @return Указатель на клип анимации.
+     */
+    const AnimationClip* LoadAnimationClip(const std::string& ClipName, const std::string& TexturePath,
+                                           const std::vector<sf::IntRect>& Frames, float FrameSpeed);
+
     /**
      * @brief Устанавливает размер спрайта.
      * 
@@ -42,4 +130,9 @@ public:
      * @param OriginY Относительная координата Y точки происхождения формы (0.0 - 1.0).
      */
     void SetShapeRelativeOrigin(sf::Shape& Shape, float OriginX, float OriginY);
+
+private:
+    ATextureAtlas TextureAtlas;                                                 // Таблица атласа текстур
+    std::unordered_map<std::string, std::shared_ptr<sf::Texture>> TextureCache; // Загруженные текстуры по пути к файлу
+    std::unordered_map<std::string, AnimationClip> AnimationClipLibrary;        // Клипы анимации по имени, адреса клипов не меняются
 };
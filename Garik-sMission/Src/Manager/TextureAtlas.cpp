@@ -0,0 +1,139 @@
+﻿#include "TextureAtlas.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <ranges>
+#include <sstream>
+
+/**
+ * @brief Загружает таблицу атласа, прежняя таблица удаляется.
+ *
+ * @param AtlasTablePath Путь к таблице атласа.
+ *
+ * @return true, если таблица загружена, false, если файла таблицы нет (атлас ещё не собран).
+ */
+bool ATextureAtlas::LoadTextureAtlas(const std::string& AtlasTablePath)
+{
+    ClearTextureAtlas();
+
+    std::ifstream AtlasTable(AtlasTablePath);
+    if (!AtlasTable.is_open())
+    {
+        return false;
+    }
+
+    // Файлы страниц лежат рядом с таблицей
+    const size_t SeparatorIndex = AtlasTablePath.find_last_of("/\\");
+    const std::string AtlasDirectory = SeparatorIndex == std::string::npos
+                                           ? std::string()
+                                           : AtlasTablePath.substr(0, SeparatorIndex + 1);
+
+    std::string Line;
+    while (std::getline(AtlasTable, Line))
+    {
+        std::istringstream LineStream(Line);
+        std::string Keyword;
+        if (!(LineStream >> Keyword) || Keyword[0] == '#')
+        {
+            continue;
+        }
+
+        if (Keyword == "page")
+        {
+            size_t PageIndex = 0;
+            std::string PageFile;
+            if (!(LineStream >> PageIndex >> PageFile))
+            {
+                throw std::runtime_error("Error: Invalid page in texture atlas: " + AtlasTablePath);
+            }
+
+            if (PagePaths.size() <= PageIndex)
+            {
+                PagePaths.resize(PageIndex + 1);
+            }
+            PagePaths[PageIndex] = AtlasDirectory + PageFile;
+        }
+        else if (Keyword == "region")
+        {
+            std::string RegionName;
+            AtlasRegion Region;
+            if (!(LineStream >> RegionName >> Region.PageIndex
+                             >> Region.Rect.left >> Region.Rect.top >> Region.Rect.width >> Region.Rect.height))
+            {
+                throw std::runtime_error("Error: Invalid region in texture atlas: " + AtlasTablePath);
+            }
+
+            Regions[RegionName] = Region;
+        }
+    }
+
+    // Каждая область должна ссылаться на описанную страницу
+    for (const AtlasRegion& Region : Regions | std::views::values)
+    {
+        if (Region.PageIndex >= PagePaths.size() || PagePaths[Region.PageIndex].empty())
+        {
+            throw std::runtime_error("Error: Texture atlas region refers to a missing page: " + AtlasTablePath);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Удаляет таблицу атласа, листы снова загружаются отдельными текстурами.
+ */
+void ATextureAtlas::ClearTextureAtlas()
+{
+    PagePaths.clear();
+    Regions.clear();
+}
+
+/**
+ * @brief Поиск области листа в атласе.
+ *
+ * @param TexturePath Путь к исходному файлу листа.
+ *
+ * @return Указатель на область листа или nullptr, если лист не упакован в атлас.
+ */
+const AtlasRegion* ATextureAtlas::FindAtlasRegion(const std::string& TexturePath) const
+{
+    if (Regions.empty())
+    {
+        return nullptr;
+    }
+
+    const auto It = Regions.find(MakeAtlasRegionName(TexturePath));
+    return It != Regions.end() ? &It->second : nullptr;
+}
+
+/**
+ * @brief Получение пути к файлу страницы атласа.
+ *
+ * @param PageIndex Индекс страницы атласа.
+ *
+ * @return Путь к файлу страницы.
+ */
+const std::string& ATextureAtlas::GetAtlasPagePath(uint16_t PageIndex) const
+{
+    return PagePaths[PageIndex];
+}
+
+/**
+ * @brief Получение имени листа в таблице атласа по пути к его файлу.
+ *
+ * @param TexturePath Путь к файлу листа.
+ *
+ * @return Имя файла листа в нижнем регистре.
+ */
+std::string ATextureAtlas::MakeAtlasRegionName(const std::string& TexturePath)
+{
+    // Регистр имени не учитывается, как и в файловой системе Windows (Player.png и player.png - один лист)
+    const size_t SeparatorIndex = TexturePath.find_last_of("/\\");
+    std::string RegionName = SeparatorIndex == std::string::npos ? TexturePath : TexturePath.substr(SeparatorIndex + 1);
+    std::transform(RegionName.begin(), RegionName.end(), RegionName.begin(), [](unsigned char Symbol)
+    {
+        return static_cast<char>(std::tolower(Symbol));
+    });
+
+    return RegionName;
+}
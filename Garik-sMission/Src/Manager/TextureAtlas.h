@@ -0,0 +1,82 @@
+﻿#pragma once
+#include <unordered_map>
+#include <vector>
+#include "../Constants.h"
+
+/**
+ * @brief Область листа спрайтов на странице атласа.
+ */
+struct AtlasRegion
+{
+    uint16_t PageIndex = 0;                 // Индекс страницы атласа
+    sf::IntRect Rect;                       // Положение листа на странице атласа
+};
+
+/**
+ * @brief Таблица атласа текстур, собранного утилитой AtlasPacker.
+ *
+ * Атлас состоит из одной или нескольких страниц (PNG), на которые упакованы листы спрайтов.
+ * Таблица хранится текстом рядом со страницами, по строке на запись:
+ *   page <индекс> <файл страницы>
+ *   region <имя листа> <индекс страницы> <left> <top> <width> <height>
+ * Имя листа - имя файла листа в нижнем регистре, поэтому лист находится по любому пути к исходному файлу.
+ * Сами текстуры страниц загружает и кэширует ASpriteManager.
+ */
+class ATextureAtlas
+{
+public:
+    /**
+     * @brief Конструктор класса ATextureAtlas.
+     */
+    ATextureAtlas() = default;
+
+    /**
+     * @brief Деструктор класса ATextureAtlas.
+     */
+    ~ATextureAtlas() = default;
+
+    /**
+     * @brief Загружает таблицу атласа, прежняя таблица удаляется.
+     *
+     * @param AtlasTablePath Путь к таблице атласа.
+     *
+     * @return true, если таблица загружена, false, если файла таблицы нет (атлас ещё не собран).
+     */
+    bool LoadTextureAtlas(const std::string& AtlasTablePath);
+
+    /**
+     * @brief Удаляет таблицу атласа, листы снова загружаются отдельными текстурами.
+     */
+    void ClearTextureAtlas();
+
+    /**
+     * @brief Поиск области листа в атласе.
+     *
+     * @param TexturePath Путь к исходному файлу листа.
+     *
+     * @return Указатель на область листа или nullptr, если лист не упакован в атлас.
+     */
+    const AtlasRegion* FindAtlasRegion(const std::string& TexturePath) const;
+
+    /**
+     * @brief Получение пути к файлу страницы атласа.
+     *
+     * @param PageIndex Индекс страницы атласа.
+     *
+     * @return Путь к файлу страницы.
+     */
+    const std::string& GetAtlasPagePath(uint16_t PageIndex) const;
+
+    /**
+     * @brief Получение имени листа в таблице атласа по пути к его файлу.
+     *
+     * @param TexturePath Путь к файлу листа.
+     *
+     * @return Имя файла листа в нижнем регистре.
+     */
+    static std::string MakeAtlasRegionName(const std::string& TexturePath);
+
+private:
+    std::vector<std::string> PagePaths;                         // Пути к файлам страниц атласа по индексу
+    std::unordered_map<std::string, AtlasRegion> Regions;       // Области листов по имени листа
+};
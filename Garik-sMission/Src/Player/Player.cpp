@@ -76,64 +76,58 @@ void APlayer::InitPlayer(ASpriteManager& SpriteManager)
                       HealthBarFrontColor, HealthBarBackgroundColor,
                       SpriteManager);
     
-    // Анимация ожидания(Idle)
-    IdleAnimation.AnimTexture.loadFromFile(PlayerTexturePath);
-    IdleAnimation.FrameSpeed = 3.f;
+    // Клипы анимаций персонажа создаются один раз, при повторной инициализации берутся из библиотеки
+    const int PlayerFrameWidth = static_cast<int>(PLAYER_SIZE.x);
+    const int PlayerFrameHeight = static_cast<int>(PLAYER_SIZE.y);
 
-    IdleAnimation.FrameRect.emplace_back(sf::IntRect(3, 0, static_cast<int>(PLAYER_SIZE.x),
-                                                     static_cast<int>(PLAYER_SIZE.y)));
-    IdleAnimation.FrameRect.emplace_back(sf::IntRect(PlayerRectTexture));
+    // Анимация ожидания(Idle)
+    IdleAnimation.SetAnimationClip(SpriteManager.LoadAnimationClip("Player_Idle", PlayerTexturePath,
+        {
+            sf::IntRect(3, 0, PlayerFrameWidth, PlayerFrameHeight),
+            sf::IntRect(PlayerRectTexture)
+        }, 3.f));
 
     // Анимация бега(Walk)
-    WalkAnimation.AnimTexture.loadFromFile(PlayerTexturePath);
-
-    WalkAnimation.FrameSpeed = 10.f;
-
-    WalkAnimation.FrameRect.emplace_back(sf::IntRect(3, 16, static_cast<int>(PLAYER_SIZE.x),
-                                                     static_cast<int>(PLAYER_SIZE.y)));
-
-    WalkAnimation.FrameRect.emplace_back(sf::IntRect(17, 16, static_cast<int>(PLAYER_SIZE.x),
-                                                     static_cast<int>(PLAYER_SIZE.y)));
-
-    WalkAnimation.FrameRect.emplace_back(sf::IntRect(35, 16, static_cast<int>(PLAYER_SIZE.x),
-                                                     static_cast<int>(PLAYER_SIZE.y)));
+    WalkAnimation.SetAnimationClip(SpriteManager.LoadAnimationClip("Player_Walk", PlayerTexturePath,
+        {
+            sf::IntRect(3, 16, PlayerFrameWidth, PlayerFrameHeight),
+            sf::IntRect(17, 16, PlayerFrameWidth, PlayerFrameHeight),
+            sf::IntRect(35, 16, PlayerFrameWidth, PlayerFrameHeight)
+        }, 10.f));
 
     // Анимация прыжка(Jump)
     // Анимация прыжка, когда персонаж летит вверх
-    JumpUpAnimation.AnimTexture.loadFromFile(PlayerTexturePath);
-
-    JumpUpAnimation.FrameSpeed = 0.f;
-    JumpUpAnimation.FrameRect.emplace_back(sf::IntRect(2, 32, static_cast<int>(PLAYER_SIZE.x),
-                                                       static_cast<int>(PLAYER_SIZE.y)));
+    JumpUpAnimation.SetAnimationClip(SpriteManager.LoadAnimationClip("Player_JumpUp", PlayerTexturePath,
+        {
+            sf::IntRect(2, 32, PlayerFrameWidth, PlayerFrameHeight)
+        }, 0.f));
 
     // Анимация прыжка, когда персонаж уже прыгнул и летит вниз
-    JumpDownAnimation.AnimTexture.loadFromFile(PlayerTexturePath);
-
-    JumpDownAnimation.FrameSpeed = 2.f;
-
-    JumpDownAnimation.FrameRect.emplace_back(sf::IntRect(18, 33, static_cast<int>(PLAYER_SIZE.x),
-                                                         static_cast<int>(PLAYER_SIZE.y)));
-
-    JumpDownAnimation.FrameRect.emplace_back(sf::IntRect(35, 33, static_cast<int>(PLAYER_SIZE.x),
-                                                         static_cast<int>(PLAYER_SIZE.y)));
-
-    JumpDownAnimation.FrameRect.emplace_back(sf::IntRect(51, 33, static_cast<int>(PLAYER_SIZE.x),
-                                                         static_cast<int>(PLAYER_SIZE.y)));
-
+    JumpDownAnimation.SetAnimationClip(SpriteManager.LoadAnimationClip("Player_JumpDown", PlayerTexturePath,
+        {
+            sf::IntRect(18, 33, PlayerFrameWidth, PlayerFrameHeight),
+            sf::IntRect(35, 33, PlayerFrameWidth, PlayerFrameHeight),
+            sf::IntRect(51, 33, PlayerFrameWidth, PlayerFrameHeight)
+        }, 2.f));
 
     // Анимация смерти персонажа
-    DeathAnimation.FrameRect.emplace_back(sf::IntRect(0, 50, 15, 60));
+    DeathAnimation.SetAnimationClip(SpriteManager.LoadAnimationClip("Player_Death", PlayerTexturePath,
+        {
+            sf::IntRect(0, 50, 15, 60)
+        }, 0.f));
 }
 
 /**
 * @brief Обработка выстрелов персонажа.
 *
 * @param BulletsVectorPtr Указатель на вектор пуль для добавления новой пули.
+* @param BulletPool Пул, из которого берётся пуля.
 * @param SoundManager Менеджер звуков для воспроизведения звуков выстрелов.
 * @param SpriteManager Менеджер спрайтов для загрузки текстур.
 * @param ParticleSystem Менеджер систем частиц для создания эффектов выстрелов.
 */
 void APlayer::HandlePlayerShoots(std::vector<ABullet*>& BulletsVectorPtr,
+                                 ABulletPool& BulletPool,
                                  ASoundManager& SoundManager,
                                  ASpriteManager& SpriteManager,
                                  AParticleSystemManager& ParticleSystem) const
@@ -144,12 +138,16 @@ void APlayer::HandlePlayerShoots(std::vector<ABullet*>& BulletsVectorPtr,
     const sf::IntRect BulletRectTexture = sf::IntRect(7, 72, static_cast<int>(BULLET_SIZE.x),
                                                       static_cast<int>(BULLET_SIZE.y));
 
-    BulletsVectorPtr.emplace_back(new ABullet(bIsMoveRight, BULLET_SPEED + 10, BULLET_DAMAGE, BulletRectTexture,
-                                              EBulletType::EBT_ShootAtEnemy,
-                                              EBulletDestroyEffect::EBDE_BulletDefaultDestroy,
-                                              sf::Vector2f(ActorCollisionRect.left + BulletOffsetX,
-                                                           ActorCollisionRect.top + BulletOffsetY),
-                                              SpriteManager));
+    ABullet* Bullet = BulletPool.AcquireBullet(bIsMoveRight, BULLET_SPEED + 10, BULLET_DAMAGE, BulletRectTexture,
+                                               EBulletType::EBT_ShootAtEnemy,
+                                               EBulletDestroyEffect::EBDE_BulletDefaultDestroy,
+                                               sf::Vector2f(ActorCollisionRect.left + BulletOffsetX,
+                                                            ActorCollisionRect.top + BulletOffsetY),
+                                               SpriteManager);
+    if (Bullet)
+    {
+        BulletsVectorPtr.emplace_back(Bullet);
+    }
 
     // Проигрываем эффект "Пламя из ствола"
     const float EffectOffsetX = bIsMoveRight ? 11.f : 1.f;
@@ -403,6 +401,9 @@ void APlayer::ResetPlayer()
     PawnCurrentHealth = PawnMaxHealth;
     ActorVelocity = {0.f, 0.f};
 
+    // После перезапуска персонаж не находится ни в одной зоне-триггере
+    PawnTriggerOverlapState.ClearOverlaps();
+
     // Прямоугольник персонажа с учетом масштабирования
     ActorCollisionRect = {
         0.f, 0.f,
@@ -434,6 +435,21 @@ void APlayer::DrawActor(sf::RenderWindow& Window)
     Window.draw(HealthBarSprite);
 }
 
+/**
+ * @brief Добавляет персонажа в пакетную отрисовку.
+ * Спрайт персонажа попадает в переданный слой, шкала здоровья и её значок в слой интерфейса.
+ * 
+ * @param SpriteBatch Пакетная отрисовка кадра.
+ * @param Layer Слой отрисовки спрайта персонажа.
+ */
+void APlayer::BatchActor(ASpriteBatch& SpriteBatch, ERenderLayer Layer) const
+{
+    SpriteBatch.AddSprite(ActorSprite, Layer);
+
+    PawnHealthBarPtr->BatchHealthBar(SpriteBatch, ERenderLayer::ERL_HUD);
+    SpriteBatch.AddSprite(HealthBarSprite, ERenderLayer::ERL_HUD);
+}
+
 /**
 * @brief Получить по ссылке данные, если персонаж находить рядом с лестницей и может карабкаться по ней.
 * 
@@ -1,6 +1,6 @@
 ﻿#pragma once
 #include "../Abstract/APawn.h"
-#include "../Bullet/Bullet.h"
+#include "../Bullet/BulletPool.h"
 #include "../Manager/ASoundManager.h"
 #include "../Manager/AnimationManager.h"
 #include "../Manager/ParticleSystemManager.h"
@@ -37,11 +37,13 @@ public:
      * @brief Обработка выстрелов персонажа.
      *
      * @param BulletsVectorPtr Указатель на вектор пуль для добавления новой пули.
+     * @param BulletPool Пул, из которого берётся пуля.
      * @param SoundManager Менеджер звуков для воспроизведения звуков выстрелов.
      * @param SpriteManager Менеджер спрайтов для загрузки текстур.
      * @param ParticleSystem Менеджер систем частиц для создания эффектов выстрелов.
      */
     void HandlePlayerShoots(std::vector<ABullet*>& BulletsVectorPtr,
+                            ABulletPool& BulletPool,
                             ASoundManager& SoundManager,
                             ASpriteManager& SpriteManager,
                             AParticleSystemManager& ParticleSystem) const;
@@ -99,6 +101,15 @@ public:
     */
     void DrawActor(sf::RenderWindow& Window) override;
 
+   /**
+    * @brief Добавляет персонажа в пакетную отрисовку.
+    * Спрайт персонажа попадает в переданный слой, шкала здоровья и её значок в слой интерфейса.
+    * 
+    * @param SpriteBatch Пакетная отрисовка кадра.
+    * @param Layer Слой отрисовки спрайта персонажа.
+    */
+    void BatchActor(ASpriteBatch& SpriteBatch, ERenderLayer Layer) const override;
+
     /**
      * @brief Получить по ссылке данные, если персонаж находится рядом с лестницей и может карабкаться по ней.
      * 
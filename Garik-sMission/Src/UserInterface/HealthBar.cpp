@@ -58,3 +58,15 @@ void AHealthBar::DrawHealthBar(sf::RenderWindow& Window) const
     Window.draw(BackgroundBarRect);
     Window.draw(HealthBarRect);
 }
+
+/**
+* @brief Добавляет фон и заполнение полосы здоровья в пакетную отрисовку однотонными прямоугольниками.
+*
+* @param SpriteBatch Пакетная отрисовка кадра.
+* @param Layer Слой отрисовки полосы здоровья.
+*/
+void AHealthBar::BatchHealthBar(ASpriteBatch& SpriteBatch, ERenderLayer Layer) const
+{
+    SpriteBatch.AddSolidRectangle(BackgroundBarRect, Layer);
+    SpriteBatch.AddSolidRectangle(HealthBarRect, Layer);
+}
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "../Constants.h"
 #include "../Manager/SpriteManager.h"
+#include "../Manager/SpriteBatch.h"
 
 /**
  * @brief Класс для отображения полосы здоровья.
@@ -53,6 +54,14 @@ public:
      */
     void DrawHealthBar(sf::RenderWindow& Window) const;
 
+    /**
+     * @brief Добавляет фон и заполнение полосы здоровья в пакетную отрисовку однотонными прямоугольниками.
+     *
+     * @param SpriteBatch Пакетная отрисовка кадра.
+     * @param Layer Слой отрисовки полосы здоровья.
+     */
+    void BatchHealthBar(ASpriteBatch& SpriteBatch, ERenderLayer Layer) const;
+
 private:
     sf::RectangleShape BackgroundBarRect;     // Прямоугольник фона полосы здоровья
     sf::RectangleShape HealthBarRect;         // Прямоугольник заполнения полосы здоровья
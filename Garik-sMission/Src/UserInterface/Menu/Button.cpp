@@ -16,28 +16,28 @@ AButton::AButton()
 /**
 * @brief Инициализирует кнопку с заданными текстурами и кадрами.
 *
+* @param ButtonName Имя кнопки, по нему в библиотеке хранится клип анимации кнопки.
 * @param TexturePath Путь к текстуре кнопки.
 * @param DefaultFrame Прямоугольник для нормального состояния кнопки.
 * @param HoverFrame Прямоугольник для состояния наведения на кнопку.
+* @param SpriteManager Менеджер спрайтов с кэшем текстур.
 */
-void AButton::InitButton(const std::string& TexturePath,
+void AButton::InitButton(const std::string& ButtonName,
+                         const std::string& TexturePath,
                          const sf::IntRect& DefaultFrame,
-                         const sf::IntRect& HoverFrame)
+                         const sf::IntRect& HoverFrame,
+                         ASpriteManager& SpriteManager)
 {
-    if (!ButtonAnimation.FrameRect.empty())
+    if (ButtonAnimation.GetAnimationClip())
     {
         ButtonAnimation.ResetAnimation();
     }
     
-    if (!ButtonAnimation.AnimTexture.loadFromFile(TexturePath))
-    {
-        throw std::runtime_error("Error: Failed to load texture: " + ASSETS_PATH + TexturePath);
-    }
-    
-    ButtonAnimation.FrameRect.emplace_back(DefaultFrame);
-    ButtonAnimation.FrameRect.emplace_back(HoverFrame);
+    // Все кнопки меню используют одну текстуру из кэша, кадры кнопки хранятся в клипе один раз
+    ButtonAnimation.SetAnimationClip(SpriteManager.LoadAnimationClip(
+        "Button_" + ButtonName, TexturePath, {DefaultFrame, HoverFrame}, 0.f));
 
-    ButtonSprite.setTexture(ButtonAnimation.AnimTexture);
+    ButtonSprite.setTexture(ButtonAnimation.GetAnimationTexture());
     ButtonSprite.setTextureRect(ButtonAnimation.GetCurrentFrame());
 }
 
@@ -22,13 +22,17 @@ public:
     /**
      * @brief Инициализирует кнопку с заданными текстурами и кадрами.
      *
+     * @param ButtonName Имя кнопки, по нему в библиотеке хранится клип анимации кнопки.
      * @param TexturePath Путь к текстуре кнопки.
      * @param DefaultFrame Прямоугольник для нормального состояния кнопки.
      * @param HoverFrame Прямоугольник для состояния наведения на кнопку.
+     * @param SpriteManager Менеджер спрайтов с кэшем текстур.
      */
-    void InitButton(const std::string& TexturePath,
+    void InitButton(const std::string& ButtonName,
+                    const std::string& TexturePath,
                     const sf::IntRect& DefaultFrame,
-                    const sf::IntRect& HoverFrame);
+                    const sf::IntRect& HoverFrame,
+                    ASpriteManager& SpriteManager);
 
     /**
      * @brief Устанавливает состояние кнопки (нажата или нет).
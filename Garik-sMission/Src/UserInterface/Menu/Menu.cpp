@@ -101,8 +101,10 @@ AMenu::~AMenu()
 
 /**
 * @brief Инициализирует меню.
+*
+* @param SpriteManager Менеджер спрайтов с кэшем текстур.
 */
-void AMenu::InitMenu()
+void AMenu::InitMenu(ASpriteManager& SpriteManager)
 {
     // Размер кнопок
     sf::Vector2i ButtonSize = {50, 19};
@@ -138,36 +140,36 @@ void AMenu::InitMenu()
     MenuSprite.setScale(0.1336f, 0.111f);
 
     // Кнопка Play
-    PlayButton.InitButton(ASSETS_PATH + "MainTiles/Buttons.png",
+    PlayButton.InitButton("Play", ASSETS_PATH + "MainTiles/Buttons.png",
                           {0, 0, ButtonSize.x, ButtonSize.y},
-                          {ButtonSize.x, 0, ButtonSize.x, ButtonSize.y});
+                          {ButtonSize.x, 0, ButtonSize.x, ButtonSize.y}, SpriteManager);
     ButtonMap["Play"] = PlayButton;
 
     // Кнопка Options
-    Options.InitButton(ASSETS_PATH + "MainTiles/Buttons.png",
+    Options.InitButton("Options", ASSETS_PATH + "MainTiles/Buttons.png",
                        {0, ButtonSize.y + 1, ButtonSize.x, ButtonSize.y},
-                       {ButtonSize.x, ButtonSize.y + 1, ButtonSize.x, ButtonSize.y});
+                       {ButtonSize.x, ButtonSize.y + 1, ButtonSize.x, ButtonSize.y}, SpriteManager);
     ButtonMap["Options"] = Options;
 
     // Кнопка Exit
-    ExitButton.InitButton(ASSETS_PATH + "MainTiles/Buttons.png",
+    ExitButton.InitButton("Exit", ASSETS_PATH + "MainTiles/Buttons.png",
                           {0, 40, ButtonSize.x, ButtonSize.y},
-                          {ButtonSize.x, 40, ButtonSize.x, ButtonSize.y});
+                          {ButtonSize.x, 40, ButtonSize.x, ButtonSize.y}, SpriteManager);
     ButtonMap["Exit"] = ExitButton;
 
     // Кнопка Continue
-    ContinueButton.InitButton(ASSETS_PATH + "MainTiles/Buttons.png",
+    ContinueButton.InitButton("Continue", ASSETS_PATH + "MainTiles/Buttons.png",
                               {0, 60, 66, ButtonSize.y},
-                              {0, 79, 66, ButtonSize.y});
+                              {0, 79, 66, ButtonSize.y}, SpriteManager);
     ButtonMap["Continue"] = ContinueButton;
 
     // Кнопка Крестика(Cross), чтобы вернуться в обратно
-    Cross.InitButton(ASSETS_PATH + "MainTiles/Buttons.png", {74, 60, 17, 19}, {74, 79, 17, 19});
+    Cross.InitButton("Cross", ASSETS_PATH + "MainTiles/Buttons.png", {74, 60, 17, 19}, {74, 79, 17, 19}, SpriteManager);
     ButtonMap["Cross"] = Cross;
 
     // Кнопка Menu
-    MenuButton.InitButton(ASSETS_PATH + "MainTiles/Buttons.png", {0, 99, ButtonSize.x, ButtonSize.y},
-                          {ButtonSize.x, 100, ButtonSize.x, ButtonSize.y});
+    MenuButton.InitButton("Menu", ASSETS_PATH + "MainTiles/Buttons.png", {0, 99, ButtonSize.x, ButtonSize.y},
+                          {ButtonSize.x, 100, ButtonSize.x, ButtonSize.y}, SpriteManager);
     ButtonMap["Menu"] = MenuButton;
 }
 
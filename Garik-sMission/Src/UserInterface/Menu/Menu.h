@@ -26,8 +26,10 @@ public:
 
     /**
      * @brief Инициализирует меню.
+     *
+     * @param SpriteManager Менеджер спрайтов с кэшем текстур.
      */
-    void InitMenu();
+    void InitMenu(ASpriteManager& SpriteManager);
 
     /**
      * @brief Устанавливает позицию меню на экране.
@@ -77,3 +77,13 @@ void AUIText::DrawGameText(sf::RenderWindow& Window) const
 {
     Window.draw(MissionSprite);
 }
+
+/**
+* @brief Добавление текста миссии в пакетную отрисовку в слой интерфейса.
+*
+* @param SpriteBatch Пакетная отрисовка кадра.
+*/
+void AUIText::BatchGameText(ASpriteBatch& SpriteBatch) const
+{
+    SpriteBatch.AddSprite(MissionSprite, ERenderLayer::ERL_HUD);
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "../Constants.h"
+#include "../Manager/SpriteBatch.h"
 
 /**
  * @brief Класс для работы с текстом в игре.
@@ -41,6 +42,13 @@ public:
      */
     void DrawGameText(sf::RenderWindow& Window) const;
 
+    /**
+     * @brief Добавление текста миссии в пакетную отрисовку в слой интерфейса.
+     *
+     * @param SpriteBatch Пакетная отрисовка кадра.
+     */
+    void BatchGameText(ASpriteBatch& SpriteBatch) const;
+
 private:
     sf::Texture MissionText0;         // Текстура для текста миссии 0
     sf::Texture MissionText1;         // Текстура для текста миссии 1
@@ -0,0 +1,218 @@
+﻿#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+/**
+ * @brief Утилита сборки атласа текстур для Garik's Mission.
+ *
+ * Упаковывает листы спрайтов в одну или несколько страниц атласа и записывает таблицу "имя листа -> область",
+ * которую читает ATextureAtlas в игре. Запускается перед сборкой игры:
+ *   AtlasPacker <папка листов> <путь к таблице атласа> <лист> [<лист> ...]
+ * Страницы сохраняются рядом с таблицей под именем таблицы с номером страницы (MainTiles0.png, MainTiles1.png, ...).
+ */
+
+/**
+ * @brief Наибольший размер стороны страницы атласа, поддерживается любой видеокартой.
+ */
+constexpr unsigned int ATLAS_PAGE_MAX_SIZE = 1024;
+
+/**
+ * @brief Прозрачный отступ вокруг каждого листа, чтобы соседние листы не попадали в выборку текстуры.
+ */
+constexpr unsigned int ATLAS_SHEET_PADDING = 2;
+
+/**
+ * @brief Лист спрайтов, который упаковывается в атлас.
+ */
+struct AtlasSheet
+{
+    std::string RegionName;                 // Имя листа в таблице атласа
+    sf::Image Image;                        // Изображение листа
+    sf::IntRect Rect;                       // Область листа на странице
+    size_t PageIndex = 0;                   // Индекс страницы, на которую попал лист
+};
+
+/**
+ * @brief Страница атласа, заполняемая полками: листы ставятся слева направо, полка высотой с самый высокий лист.
+ */
+struct AtlasPage
+{
+    unsigned int ShelfTop = 0;              // Верх текущей полки
+    unsigned int ShelfHeight = 0;           // Высота текущей полки
+    unsigned int CursorX = 0;               // Левый край следующего листа на полке
+    sf::Vector2u UsedSize;                  // Занятый размер страницы
+};
+
+/**
+ * @brief Получение имени листа в таблице атласа по пути к его файлу, совпадает с ATextureAtlas::MakeAtlasRegionName.
+ *
+ * @param SheetPath Путь к файлу листа.
+ *
+ * @return Имя файла листа в нижнем регистре.
+ */
+std::string MakeAtlasRegionName(const std::string& SheetPath)
+{
+    std::string RegionName = std::filesystem::path(SheetPath).filename().string();
+    std::transform(RegionName.begin(), RegionName.end(), RegionName.begin(), [](unsigned char Symbol)
+    {
+        return static_cast<char>(std::tolower(Symbol));
+    });
+
+    return RegionName;
+}
+
+/**
+ * @brief Пытается поставить лист на страницу, при нехватке места на полке начинает новую полку.
+ *
+ * @param Page Страница атласа.
+ * @param Sheet Лист спрайтов.
+ *
+ * @return true, если лист поместился на страницу, иначе false.
+ */
+bool PlaceSheetOnPage(AtlasPage& Page, AtlasSheet& Sheet)
+{
+    const unsigned int Width = Sheet.Image.getSize().x + ATLAS_SHEET_PADDING;
+    const unsigned int Height = Sheet.Image.getSize().y + ATLAS_SHEET_PADDING;
+
+    if (Page.CursorX + Width > ATLAS_PAGE_MAX_SIZE)
+    {
+        Page.ShelfTop += Page.ShelfHeight;
+        Page.ShelfHeight = 0;
+        Page.CursorX = 0;
+    }
+
+    if (Page.ShelfTop + Height > ATLAS_PAGE_MAX_SIZE)
+    {
+        return false;
+    }
+
+    Sheet.Rect = {
+        static_cast<int>(Page.CursorX), static_cast<int>(Page.ShelfTop),
+        static_cast<int>(Sheet.Image.getSize().x), static_cast<int>(Sheet.Image.getSize().y)
+    };
+
+    Page.CursorX += Width;
+    Page.ShelfHeight = std::max(Page.ShelfHeight, Height);
+    Page.UsedSize.x = std::max(Page.UsedSize.x, Page.CursorX);
+    Page.UsedSize.y = std::max(Page.UsedSize.y, Page.ShelfTop + Page.ShelfHeight);
+    return true;
+}
+
+/**
+ * @brief Упаковывает листы в страницы атласа и сохраняет страницы и таблицу атласа.
+ *
+ * @param SheetDirectory Папка с листами спрайтов.
+ * @param AtlasTablePath Путь к таблице атласа.
+ * @param SheetNames Имена файлов листов.
+ */
+void PackTextureAtlas(const std::filesystem::path& SheetDirectory, const std::filesystem::path& AtlasTablePath,
+                      const std::vector<std::string>& SheetNames)
+{
+    std::vector<AtlasSheet> Sheets;
+    Sheets.reserve(SheetNames.size());
+
+    for (const std::string& SheetName : SheetNames)
+    {
+        AtlasSheet& Sheet = Sheets.emplace_back();
+        Sheet.RegionName = MakeAtlasRegionName(SheetName);
+
+        const std::string SheetPath = (SheetDirectory / SheetName).string();
+        if (!Sheet.Image.loadFromFile(SheetPath))
+        {
+            throw std::runtime_error("Error: Failed to load sheet: " + SheetPath);
+        }
+
+        const sf::Vector2u SheetSize = Sheet.Image.getSize();
+        if (SheetSize.x + ATLAS_SHEET_PADDING > ATLAS_PAGE_MAX_SIZE || SheetSize.y + ATLAS_SHEET_PADDING > ATLAS_PAGE_MAX_SIZE)
+        {
+            throw std::runtime_error("Error: Sheet does not fit into an atlas page: " + SheetPath);
+        }
+    }
+
+    // Высокие листы первыми, так полки заполняются плотнее
+    std::stable_sort(Sheets.begin(), Sheets.end(), [](const AtlasSheet& Left, const AtlasSheet& Right)
+    {
+        return Left.Image.getSize().y > Right.Image.getSize().y;
+    });
+
+    std::vector<AtlasPage> Pages(1);
+    for (AtlasSheet& Sheet : Sheets)
+    {
+        if (!PlaceSheetOnPage(Pages.back(), Sheet))
+        {
+            Pages.emplace_back();
+            PlaceSheetOnPage(Pages.back(), Sheet);
+        }
+        Sheet.PageIndex = Pages.size() - 1;
+    }
+
+    std::filesystem::create_directories(AtlasTablePath.parent_path());
+
+    std::ofstream AtlasTable(AtlasTablePath);
+    if (!AtlasTable.is_open())
+    {
+        throw std::runtime_error("Error: Failed to create atlas table: " + AtlasTablePath.string());
+    }
+    AtlasTable << "# Generated by AtlasPacker, do not edit\n";
+
+    const std::string PageStem = AtlasTablePath.stem().string();
+    for (size_t PageIndex = 0; PageIndex < Pages.size(); ++PageIndex)
+    {
+        // Пустое место страницы остаётся прозрачным
+        sf::Image PageImage;
+        PageImage.create(Pages[PageIndex].UsedSize.x, Pages[PageIndex].UsedSize.y, sf::Color::Transparent);
+
+        for (const AtlasSheet& Sheet : Sheets)
+        {
+            if (Sheet.PageIndex == PageIndex)
+            {
+                PageImage.copy(Sheet.Image, Sheet.Rect.left, Sheet.Rect.top);
+            }
+        }
+
+        const std::string PageFile = PageStem + std::to_string(PageIndex) + ".png";
+        const std::string PagePath = (AtlasTablePath.parent_path() / PageFile).string();
+        if (!PageImage.saveToFile(PagePath))
+        {
+            throw std::runtime_error("Error: Failed to save atlas page: " + PagePath);
+        }
+
+        AtlasTable << "page " << PageIndex << ' ' << PageFile << '\n';
+    }
+
+    for (const AtlasSheet& Sheet : Sheets)
+    {
+        AtlasTable << "region " << Sheet.RegionName << ' ' << Sheet.PageIndex << ' '
+            << Sheet.Rect.left << ' ' << Sheet.Rect.top << ' ' << Sheet.Rect.width << ' ' << Sheet.Rect.height << '\n';
+    }
+
+    std::cout << "AtlasPacker: " << Sheets.size() << " sheets packed into " << Pages.size() << " page(s)\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 4)
+    {
+        std::cerr << "Usage: AtlasPacker <sheet directory> <atlas table path> <sheet> [<sheet> ...]\n";
+        return 1;
+    }
+
+    try
+    {
+        PackTextureAtlas(argv[1], argv[2], std::vector<std::string>(argv + 3, argv + argc));
+    }
+    catch (const std::exception& Exception)
+    {
+        std::cerr << Exception.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}